@@ -90,52 +90,117 @@ class QQuickCalendarModelPrivate : public QAbstractItemModelPrivate
 
 public:
     QQuickCalendarModelPrivate() : complete(false),
-        from(1,1,1), to(275759, 9, 25), count(0)
+        from(1,1,1), to(275759, 9, 25), first(0), count(0)
     {
     }
 
+    static int monthNumber(const QDate &date);
+    static int monthOf(int number);
+    static int yearOf(int number);
     static int getCount(const QDate& from, const QDate &to);
 
     void populate(const QDate &from, const QDate &to, bool force = false);
+    void removeRows(int row, int count);
+    void insertRows(int row, int count);
 
     bool complete;
     QDate from;
     QDate to;
+    int first;
     int count;
 };
 
+// Months are numbered continuously across years, so that the month at any
+// given model index can be calculated without iterating over dates. There
+// is no year 0; 1 BCE (year -1) is immediately followed by 1 CE (year 1).
+int QQuickCalendarModelPrivate::monthNumber(const QDate &date)
+{
+    int year = date.year();
+    if (year < 0)
+        ++year;
+    return 12 * year + date.month() - 1;
+}
+
+int QQuickCalendarModelPrivate::monthOf(int number)
+{
+    return (number % 12 + 12) % 12;
+}
+
+int QQuickCalendarModelPrivate::yearOf(int number)
+{
+    const int year = (number - monthOf(number)) / 12;
+    return year > 0 ? year : year - 1;
+}
+
 int QQuickCalendarModelPrivate::getCount(const QDate& from, const QDate &to)
 {
     if (!from.isValid() || !to.isValid())
         return 0;
 
-    QDate f(from.year(), from.month(), 1);
-    QDate t(to.year(), to.month(), to.daysInMonth());
-    int days = f.daysTo(t);
-    if (days < 0)
-        return 0;
-
-    QDate r = QDate(1, 1, 1).addDays(days);
-    int years = r.year() - 1;
-    int months = r.month() - 1;
-    return 12 * years + months + (r.day() / t.day());
+    return qMax(0, monthNumber(to) - monthNumber(from) + 1);
 }
 
+// Months that are in both the old and the new range keep their rows, so
+// that views can keep their delegates. Months are only inserted or removed
+// at either end, and the model is reset only if the ranges do not overlap.
 void QQuickCalendarModelPrivate::populate(const QDate &f, const QDate &t, bool force)
 {
     Q_Q(QQuickCalendarModel);
     if (!force && f == from && t == to)
         return;
 
-    int c = getCount(from, to);
-    if (c != count) {
-        q->beginResetModel();
-        count = c;
-        q->endResetModel();
-        emit q->countChanged();
+    const int oldCount = count;
+    const int newCount = getCount(f, t);
+    const int newFirst = newCount > 0 ? monthNumber(f) : 0;
+    from = f;
+    to = t;
+
+    if (force || !count || !newCount || newFirst >= first + count || newFirst + newCount <= first) {
+        if (!force && count && count == newCount) {
+            first = newFirst;
+            emit q->dataChanged(q->index(0, 0), q->index(count - 1, 0));
+        } else {
+            q->beginResetModel();
+            first = newFirst;
+            count = newCount;
+            q->endResetModel();
+        }
     } else {
-        emit q->dataChanged(q->index(0, 0), q->index(c - 1, 0));
+        if (newFirst > first)
+            removeRows(0, newFirst - first);
+        else if (newFirst < first)
+            insertRows(0, first - newFirst);
+
+        const int last = first + count;
+        const int newLast = newFirst + newCount;
+        if (newLast < last)
+            removeRows(count - (last - newLast), last - newLast);
+        else if (newLast > last)
+            insertRows(count, newLast - last);
     }
+
+    if (count != oldCount)
+        emit q->countChanged();
+}
+
+void QQuickCalendarModelPrivate::removeRows(int row, int n)
+{
+    Q_Q(QQuickCalendarModel);
+    q->beginRemoveRows(QModelIndex(), row, row + n - 1);
+    if (row == 0)
+        first += n;
+    count -= n;
+    q->endRemoveRows();
+}
+
+void QQuickCalendarModelPrivate::insertRows(int row, int n)
+{
+    Q_Q(QQuickCalendarModel);
+    q->beginInsertRows(QModelIndex(), row, row + n - 1);
+    if (row == 0)
+        first -= n;
+    count += n;
+    q->endInsertRows();
 }
 
 QQuickCalendarModel::QQuickCalendarModel(QObject *parent) :
@@ -195,7 +260,9 @@ void QQuickCalendarModel::setTo(const QDate &to)
 int QQuickCalendarModel::monthAt(int index) const
 {
     Q_D(const QQuickCalendarModel);
-    return d->from.addMonths(index).month() - 1;
+    if (!d->from.isValid())
+        return -1;
+    return d->monthOf(d->monthNumber(d->from) + index);
 }
 
 /*!
@@ -206,7 +273,9 @@ int QQuickCalendarModel::monthAt(int index) const
 int QQuickCalendarModel::yearAt(int index) const
 {
     Q_D(const QQuickCalendarModel);
-    return d->from.addMonths(index).year();
+    if (!d->from.isValid())
+        return 0;
+    return d->yearOf(d->monthNumber(d->from) + index);
 }
 
 /*!
@@ -217,7 +286,11 @@ int QQuickCalendarModel::yearAt(int index) const
 int QQuickCalendarModel::indexOf(const QDate &date) const
 {
     Q_D(const QQuickCalendarModel);
-    return d->getCount(d->from, date) - 1;
+    if (!d->from.isValid() || !date.isValid())
+        return -1;
+
+    const int index = d->monthNumber(date) - d->monthNumber(d->from);
+    return index < 0 ? -1 : index;
 }
 
 /*!
@@ -236,9 +309,9 @@ QVariant QQuickCalendarModel::data(const QModelIndex &index, int role) const
     if (index.isValid() && index.row() < d->count) {
         switch (role) {
         case MonthRole:
-            return monthAt(index.row());
+            return d->monthOf(d->first + index.row());
         case YearRole:
-            return yearAt(index.row());
+            return d->yearOf(d->first + index.row());
         default:
             break;
         }
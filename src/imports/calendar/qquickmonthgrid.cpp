@@ -40,6 +40,7 @@
 #include <QtGui/qstylehints.h>
 #include <QtGui/qguiapplication.h>
 #include <QtQuickTemplates2/private/qquickcontrol_p_p.h>
+#include <QtQuickTemplates2/private/qquicktimerwheel_p_p.h>
 #include <QtQml/qqmlinfo.h>
 
 QT_BEGIN_NAMESPACE
@@ -102,7 +103,7 @@ class QQuickMonthGridPrivate : public QQuickControlPrivate
     Q_DECLARE_PUBLIC(QQuickMonthGrid)
 
 public:
-    QQuickMonthGridPrivate() : pressTimer(0), pressedItem(nullptr), model(nullptr), delegate(nullptr) { }
+    QQuickMonthGridPrivate() : pressedItem(nullptr), model(nullptr), delegate(nullptr) { }
 
     void resizeItems();
 
@@ -117,7 +118,7 @@ public:
     QString title;
     QVariant source;
     QDate pressedDate;
-    int pressTimer;
+    QQuickWheelTimer pressTimer;
     QQuickItem *pressedItem;
     QQuickMonthModel *model;
     QQmlComponent *delegate;
@@ -407,7 +408,7 @@ void QQuickMonthGrid::mousePressEvent(QMouseEvent *event)
     Q_D(QQuickMonthGrid);
     d->updatePress(event->pos());
     if (d->pressedDate.isValid())
-        d->pressTimer = startTimer(qGuiApp->styleHints()->mousePressAndHoldInterval());
+        d->pressTimer.start(qGuiApp->styleHints()->mousePressAndHoldInterval(), this);
     event->accept();
 }
 
@@ -434,10 +435,10 @@ void QQuickMonthGrid::mouseUngrabEvent()
 void QQuickMonthGrid::timerEvent(QTimerEvent *event)
 {
     Q_D(QQuickMonthGrid);
-    if (event->timerId() == d->pressTimer) {
+    if (event->timerId() == d->pressTimer.timerId()) {
+        d->pressTimer.stop();
         if (d->pressedDate.isValid())
             emit pressAndHold(d->pressedDate);
-        killTimer(d->pressTimer);
     }
 }
 
@@ -44,10 +44,10 @@ T.TextArea {
 
     implicitWidth: Math.max(contentWidth + leftPadding + rightPadding,
                             background ? background.implicitWidth : 0,
-                            placeholder.implicitWidth + leftPadding + rightPadding)
+                            implicitPlaceholderWidth + leftPadding + rightPadding)
     implicitHeight: Math.max(contentHeight + topPadding + bottomPadding,
                              background ? background.implicitHeight : 0,
-                             placeholder.implicitHeight + topPadding + bottomPadding)
+                             implicitPlaceholderHeight + topPadding + bottomPadding)
 
     padding: 6
     leftPadding: padding + 4
@@ -56,19 +56,6 @@ T.TextArea {
     color: Default.textColor
     selectionColor: Default.textSelectionColor
     selectedTextColor: color
-
-    PlaceholderText {
-        id: placeholder
-        x: control.leftPadding
-        y: control.topPadding
-        width: control.width - (control.leftPadding + control.rightPadding)
-        height: control.height - (control.topPadding + control.bottomPadding)
-
-        text: control.placeholderText
-        font: control.font
-        color: Default.textDisabledLightColor
-        verticalAlignment: control.verticalAlignment
-        visible: !control.length && !control.preeditText && (!control.activeFocus || control.horizontalAlignment !== Qt.AlignHCenter)
-        elide: Text.ElideRight
-    }
+    placeholderTextColor: Default.textDisabledLightColor
+    placeholderItemEnabled: true
 }
@@ -43,11 +43,11 @@ T.TextField {
     id: control
 
     implicitWidth: Math.max(background ? background.implicitWidth : 0,
-                            placeholderText ? placeholder.implicitWidth + leftPadding + rightPadding : 0)
+                            placeholderText ? implicitPlaceholderWidth + leftPadding + rightPadding : 0)
                             || contentWidth + leftPadding + rightPadding
     implicitHeight: Math.max(contentHeight + topPadding + bottomPadding,
                              background ? background.implicitHeight : 0,
-                             placeholder.implicitHeight + topPadding + bottomPadding)
+                             implicitPlaceholderHeight + topPadding + bottomPadding)
 
     padding: 6
     leftPadding: padding + 4
@@ -56,23 +56,10 @@ T.TextField {
     color: Default.textColor
     selectionColor: Default.textSelectionColor
     selectedTextColor: color
+    placeholderTextColor: Default.textDisabledColor
+    placeholderItemEnabled: true
     verticalAlignment: TextInput.AlignVCenter
 
-    PlaceholderText {
-        id: placeholder
-        x: control.leftPadding
-        y: control.topPadding
-        width: control.width - (control.leftPadding + control.rightPadding)
-        height: control.height - (control.topPadding + control.bottomPadding)
-
-        text: control.placeholderText
-        font: control.font
-        color: Default.textDisabledColor
-        verticalAlignment: control.verticalAlignment
-        visible: !control.length && !control.preeditText && (!control.activeFocus || control.horizontalAlignment !== Qt.AlignHCenter)
-        elide: Text.ElideRight
-    }
-
     background: Rectangle {
         implicitWidth: 200
         implicitHeight: 40
@@ -65,10 +65,10 @@ T.ItemDelegate {
         verticalAlignment: Text.AlignVCenter
     }
 
-    background: Rectangle {
+    background: ControlBackground {
         implicitHeight: 48
 
-        color: control.highlighted ? control.Material.listHighlightColor : "transparent"
+        control: control
 
         Ripple {
             width: parent.width
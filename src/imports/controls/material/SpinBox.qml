@@ -58,14 +58,16 @@ T.SpinBox {
     leftPadding: (control.mirrored ? (up.indicator ? up.indicator.width : 0) : (down.indicator ? down.indicator.width : 0))
     rightPadding: (control.mirrored ? (down.indicator ? down.indicator.width : 0) : (up.indicator ? up.indicator.width : 0))
 
-    validator: IntValidator {
+    validator: DoubleValidator {
         locale: control.locale.name
-        bottom: Math.min(control.from, control.to)
-        top: Math.max(control.from, control.to)
+        bottom: Math.min(control.from, control.to) / Math.pow(10, control.decimals)
+        top: Math.max(control.from, control.to) / Math.pow(10, control.decimals)
+        decimals: control.decimals
+        notation: DoubleValidator.StandardNotation
     }
 
     contentItem: TextInput {
-        text: control.textFromValue(control.value, control.locale)
+        text: control.displayText
 
         font: control.font
         color: enabled ? control.Material.foreground : control.Material.hintTextColor
@@ -73,10 +73,10 @@ T.SwitchDelegate {
         verticalAlignment: Text.AlignVCenter
     }
 
-    background: Rectangle {
+    background: ControlBackground {
         implicitHeight: 48
 
-        color: control.highlighted ? control.Material.listHighlightColor : "transparent"
+        control: control
 
         Ripple {
             width: parent.width
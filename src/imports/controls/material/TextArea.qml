@@ -46,10 +46,10 @@ T.TextArea {
 
     implicitWidth: Math.max(contentWidth + leftPadding + rightPadding,
                             background ? background.implicitWidth : 0,
-                            placeholder.implicitWidth + leftPadding + rightPadding)
+                            implicitPlaceholderWidth + leftPadding + rightPadding)
     implicitHeight: Math.max(contentHeight + 1 + topPadding + bottomPadding,
                              background ? background.implicitHeight : 0,
-                             placeholder.implicitHeight + 1 + topPadding + bottomPadding)
+                             implicitPlaceholderHeight + 1 + topPadding + bottomPadding)
 
     topPadding: 8
     bottomPadding: 16
@@ -57,27 +57,13 @@ T.TextArea {
     color: enabled ? Material.foreground : Material.hintTextColor
     selectionColor: Material.accentColor
     selectedTextColor: Material.primaryHighlightedTextColor
+    placeholderTextColor: Material.hintTextColor
+    placeholderItemEnabled: true
 
     cursorDelegate: CursorDelegate { }
 
-    PlaceholderText {
-        id: placeholder
-        x: control.leftPadding
-        y: control.topPadding
-        width: control.width - (control.leftPadding + control.rightPadding)
-        height: control.height - (control.topPadding + control.bottomPadding)
-        text: control.placeholderText
-        font: control.font
-        color: control.Material.hintTextColor
-        verticalAlignment: control.verticalAlignment
-        elide: Text.ElideRight
-        visible: !control.length && !control.preeditText && (!control.activeFocus || control.horizontalAlignment !== Qt.AlignHCenter)
-    }
-
-    background: Rectangle {
-        y: parent.height - height - control.bottomPadding / 2
+    background: ControlBackground {
         implicitWidth: 120
-        height: control.activeFocus ? 2 : 1
-        color: control.activeFocus ? control.Material.accentColor : control.Material.hintTextColor
+        control: control
     }
 }
@@ -45,11 +45,11 @@ T.TextField {
     id: control
 
     implicitWidth: Math.max(background ? background.implicitWidth : 0,
-                            placeholderText ? placeholder.implicitWidth + leftPadding + rightPadding : 0)
+                            placeholderText ? implicitPlaceholderWidth + leftPadding + rightPadding : 0)
                             || contentWidth + leftPadding + rightPadding
     implicitHeight: Math.max(contentHeight + topPadding + bottomPadding,
                              background ? background.implicitHeight : 0,
-                             placeholder.implicitHeight + topPadding + bottomPadding)
+                             implicitPlaceholderHeight + topPadding + bottomPadding)
 
     topPadding: 8
     bottomPadding: 16
@@ -57,29 +57,14 @@ T.TextField {
     color: enabled ? Material.foreground : Material.hintTextColor
     selectionColor: Material.accentColor
     selectedTextColor: Material.primaryHighlightedTextColor
+    placeholderTextColor: Material.hintTextColor
+    placeholderItemEnabled: true
     verticalAlignment: TextInput.AlignVCenter
 
     cursorDelegate: CursorDelegate { }
 
-    PlaceholderText {
-        id: placeholder
-        x: control.leftPadding
-        y: control.topPadding
-        width: control.width - (control.leftPadding + control.rightPadding)
-        height: control.height - (control.topPadding + control.bottomPadding)
-        text: control.placeholderText
-        font: control.font
-        color: control.Material.hintTextColor
-        verticalAlignment: control.verticalAlignment
-        elide: Text.ElideRight
-        visible: !control.length && !control.preeditText && (!control.activeFocus || control.horizontalAlignment !== Qt.AlignHCenter)
-
-    }
-
-    background: Rectangle {
-        y: control.height - height - control.bottomPadding / 2
+    background: ControlBackground {
         implicitWidth: 120
-        height: control.activeFocus ? 2 : 1
-        color: control.activeFocus ? control.Material.accentColor : control.Material.hintTextColor
+        control: control
     }
 }
@@ -1,5 +1,7 @@
 HEADERS += \
     $$PWD/qquickmaterialbusyindicator_p.h \
+    $$PWD/qquickmaterialcontrolbackground_p.h \
+    $$PWD/qquickmaterialcursor_p.h \
     $$PWD/qquickmaterialprogressbar_p.h \
     $$PWD/qquickmaterialripple_p.h \
     $$PWD/qquickmaterialstyle_p.h \
@@ -7,6 +9,8 @@ HEADERS += \
 
 SOURCES += \
     $$PWD/qquickmaterialbusyindicator.cpp \
+    $$PWD/qquickmaterialcontrolbackground.cpp \
+    $$PWD/qquickmaterialcursor.cpp \
     $$PWD/qquickmaterialprogressbar.cpp \
     $$PWD/qquickmaterialripple.cpp \
     $$PWD/qquickmaterialstyle.cpp \
@@ -21,7 +25,6 @@ QML_FILES += \
     $$PWD/CheckDelegate.qml \
     $$PWD/CheckIndicator.qml \
     $$PWD/ComboBox.qml \
-    $$PWD/CursorDelegate.qml \
     $$PWD/DelayButton.qml \
     $$PWD/Dial.qml \
     $$PWD/Dialog.qml \
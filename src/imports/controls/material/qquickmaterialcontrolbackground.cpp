@@ -0,0 +1,92 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickmaterialcontrolbackground_p.h"
+#include "qquickmaterialstyle_p.h"
+
+#include <QtQuickTemplates2/private/qquicktextarea_p.h>
+#include <QtQuickTemplates2/private/qquicktextfield_p.h>
+
+QT_BEGIN_NAMESPACE
+
+QQuickMaterialControlBackground::QQuickMaterialControlBackground(QQuickItem *parent) :
+    QQuickControlBackground(parent)
+{
+}
+
+void QQuickMaterialControlBackground::controlChange(QQuickItem *newControl, QQuickItem *oldControl)
+{
+    Q_UNUSED(oldControl);
+    if (m_style)
+        disconnect(m_style, nullptr, this, nullptr);
+
+    m_style = newControl ? qobject_cast<QQuickMaterialStyle *>(qmlAttachedPropertiesObject<QQuickMaterialStyle>(newControl)) : nullptr;
+    if (m_style) {
+        connect(m_style, &QQuickMaterialStyle::paletteChanged, this, &QQuickMaterialControlBackground::invalidate);
+        connect(m_style, &QQuickMaterialStyle::accentChanged, this, &QQuickMaterialControlBackground::invalidate);
+    }
+
+    if (QQuickTextField *textField = qobject_cast<QQuickTextField *>(newControl))
+        connect(textField, &QQuickTextField::bottomPaddingChanged, this, &QQuickMaterialControlBackground::invalidate);
+    else if (QQuickTextArea *textArea = qobject_cast<QQuickTextArea *>(newControl))
+        connect(textArea, &QQuickTextArea::bottomPaddingChanged, this, &QQuickMaterialControlBackground::invalidate);
+}
+
+void QQuickMaterialControlBackground::updateBackground(States states)
+{
+    if (!m_style)
+        return;
+
+    qreal bottomPadding = -1;
+    if (QQuickTextField *textField = qobject_cast<QQuickTextField *>(control()))
+        bottomPadding = textField->bottomPadding();
+    else if (QQuickTextArea *textArea = qobject_cast<QQuickTextArea *>(control()))
+        bottomPadding = textArea->bottomPadding();
+
+    if (bottomPadding >= 0) {
+        // text controls are underlined in the middle of their bottom padding
+        const bool focused = states & ActiveFocus;
+        const qreal lineHeight = focused ? 2 : 1;
+        setRect(QRectF(0, height() - lineHeight - bottomPadding / 2, width(), lineHeight));
+        setColor(focused ? m_style->accentColor() : m_style->hintTextColor());
+    } else {
+        // delegates
+        setRect(boundingRect());
+        setColor(states & Highlighted ? m_style->listHighlightColor() : QColor(Qt::transparent));
+    }
+}
+
+QT_END_NAMESPACE
@@ -34,32 +34,43 @@
 **
 ****************************************************************************/
 
-import QtQuick 2.9
-import QtQuick.Controls.Material 2.3
+#ifndef QQUICKMATERIALCONTROLBACKGROUND_P_H
+#define QQUICKMATERIALCONTROLBACKGROUND_P_H
 
-Rectangle {
-    id: cursor
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
 
-    color: parent.Material.accentColor
-    width: 2
-    visible: parent.activeFocus && parent.selectionStart === parent.selectionEnd
+#include <QtQuickControls2/private/qquickcontrolbackground_p.h>
 
-    Connections {
-        target: cursor.parent
-        onCursorPositionChanged: {
-            // keep a moving cursor visible
-            cursor.opacity = 1
-            timer.restart()
-        }
-    }
+QT_BEGIN_NAMESPACE
 
-    Timer {
-        id: timer
-        running: cursor.parent.activeFocus
-        repeat: true
-        interval: Qt.styleHints.cursorFlashTime / 2
-        onTriggered: cursor.opacity = !cursor.opacity ? 1 : 0
-        // force the cursor visible when gaining focus
-        onRunningChanged: cursor.opacity = 1
-    }
-}
+class QQuickMaterialStyle;
+
+class QQuickMaterialControlBackground : public QQuickControlBackground
+{
+    Q_OBJECT
+
+public:
+    explicit QQuickMaterialControlBackground(QQuickItem *parent = nullptr);
+
+protected:
+    void controlChange(QQuickItem *newControl, QQuickItem *oldControl) override;
+    void updateBackground(States states) override;
+
+private:
+    QPointer<QQuickMaterialStyle> m_style;
+};
+
+QT_END_NAMESPACE
+
+QML_DECLARE_TYPE(QQuickMaterialControlBackground)
+
+#endif // QQUICKMATERIALCONTROLBACKGROUND_P_H
@@ -0,0 +1,283 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickmaterialcursor_p.h"
+#include "qquickmaterialstyle_p.h"
+
+#include <QtCore/qbasictimer.h>
+#include <QtGui/qguiapplication.h>
+#include <QtGui/qstylehints.h>
+#include <QtQuick/qquickwindow.h>
+#include <QtQuick/qsgrectanglenode.h>
+#include <QtQuick/private/qquicktextedit_p.h>
+#include <QtQuick/private/qquicktextinput_p.h>
+
+QT_BEGIN_NAMESPACE
+
+// A per-window clock that blinks all visible cursors in the window. It only
+// runs while there is at least one visible cursor, which normally is the one
+// of the text control that has active focus.
+class QQuickMaterialCursorClock : public QObject
+{
+public:
+    static QQuickMaterialCursorClock *get(QQuickWindow *window);
+
+    void add(QQuickMaterialCursor *cursor);
+    void remove(QQuickMaterialCursor *cursor);
+    void restart();
+
+protected:
+    void timerEvent(QTimerEvent *event) override;
+
+private:
+    explicit QQuickMaterialCursorClock(QQuickWindow *window) : QObject(window) { }
+
+    static int interval();
+
+    QBasicTimer m_timer;
+    QVector<QQuickMaterialCursor *> m_cursors;
+};
+
+QQuickMaterialCursorClock *QQuickMaterialCursorClock::get(QQuickWindow *window)
+{
+    const char *name = "_q_QQuickMaterialCursorClock";
+    QQuickMaterialCursorClock *clock = static_cast<QQuickMaterialCursorClock *>(window->property(name).value<QObject *>());
+    if (!clock) {
+        clock = new QQuickMaterialCursorClock(window);
+        window->setProperty(name, QVariant::fromValue<QObject *>(clock));
+    }
+    return clock;
+}
+
+int QQuickMaterialCursorClock::interval()
+{
+    return QGuiApplication::styleHints()->cursorFlashTime() / 2;
+}
+
+void QQuickMaterialCursorClock::add(QQuickMaterialCursor *cursor)
+{
+    if (m_cursors.contains(cursor))
+        return;
+
+    m_cursors += cursor;
+    if (!m_timer.isActive() && interval() > 0)
+        m_timer.start(interval(), this);
+}
+
+void QQuickMaterialCursorClock::remove(QQuickMaterialCursor *cursor)
+{
+    m_cursors.removeOne(cursor);
+    if (m_cursors.isEmpty())
+        m_timer.stop();
+}
+
+void QQuickMaterialCursorClock::restart()
+{
+    if (m_timer.isActive())
+        m_timer.start(interval(), this);
+}
+
+void QQuickMaterialCursorClock::timerEvent(QTimerEvent *event)
+{
+    if (event->timerId() != m_timer.timerId()) {
+        QObject::timerEvent(event);
+        return;
+    }
+
+    for (QQuickMaterialCursor *cursor : qAsConst(m_cursors))
+        cursor->blink();
+}
+
+QQuickMaterialCursor::QQuickMaterialCursor(QQuickItem *parent)
+    : QQuickItem(parent),
+      m_explicitColor(false)
+{
+    setFlag(ItemHasContents);
+    setImplicitWidth(2);
+    setVisible(false);
+}
+
+QQuickMaterialCursor::~QQuickMaterialCursor()
+{
+    if (m_clock)
+        m_clock->remove(this);
+}
+
+QColor QQuickMaterialCursor::color() const
+{
+    return m_color;
+}
+
+// the color defaults to the accent color of the text control
+void QQuickMaterialCursor::setColor(const QColor &color)
+{
+    m_explicitColor = true;
+    if (m_color == color)
+        return;
+
+    m_color = color;
+    update();
+    emit colorChanged();
+}
+
+void QQuickMaterialCursor::resetColor()
+{
+    if (!m_explicitColor)
+        return;
+
+    m_explicitColor = false;
+    updateColor();
+}
+
+void QQuickMaterialCursor::blink()
+{
+    setOpacity(qFuzzyIsNull(opacity()) ? 1.0 : 0.0);
+}
+
+void QQuickMaterialCursor::itemChange(ItemChange change, const ItemChangeData &data)
+{
+    QQuickItem::itemChange(change, data);
+    switch (change) {
+    case ItemParentHasChanged:
+        detach();
+        attach(data.item);
+        break;
+    case ItemSceneChange:
+    case ItemVisibleHasChanged:
+        updateClock();
+        break;
+    default:
+        break;
+    }
+}
+
+QSGNode *QQuickMaterialCursor::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    QSGRectangleNode *node = static_cast<QSGRectangleNode *>(oldNode);
+    if (!node)
+        node = window()->createRectangleNode();
+
+    node->setRect(boundingRect());
+    node->setColor(m_color);
+    return node;
+}
+
+void QQuickMaterialCursor::attach(QQuickItem *text)
+{
+    m_text = text;
+    if (QQuickTextInput *input = qobject_cast<QQuickTextInput *>(text)) {
+        m_connections += connect(input, &QQuickTextInput::cursorPositionChanged, this, &QQuickMaterialCursor::restart);
+        m_connections += connect(input, &QQuickTextInput::selectionStartChanged, this, &QQuickMaterialCursor::updateVisible);
+        m_connections += connect(input, &QQuickTextInput::selectionEndChanged, this, &QQuickMaterialCursor::updateVisible);
+    } else if (QQuickTextEdit *edit = qobject_cast<QQuickTextEdit *>(text)) {
+        m_connections += connect(edit, &QQuickTextEdit::cursorPositionChanged, this, &QQuickMaterialCursor::restart);
+        m_connections += connect(edit, &QQuickTextEdit::selectionStartChanged, this, &QQuickMaterialCursor::updateVisible);
+        m_connections += connect(edit, &QQuickTextEdit::selectionEndChanged, this, &QQuickMaterialCursor::updateVisible);
+    }
+    if (text) {
+        m_connections += connect(text, &QQuickItem::activeFocusChanged, this, &QQuickMaterialCursor::updateVisible);
+        m_style = qobject_cast<QQuickMaterialStyle *>(qmlAttachedPropertiesObject<QQuickMaterialStyle>(text));
+        if (m_style)
+            m_connections += connect(m_style, &QQuickMaterialStyle::accentChanged, this, &QQuickMaterialCursor::updateColor);
+    }
+    updateVisible();
+    updateColor();
+}
+
+void QQuickMaterialCursor::detach()
+{
+    for (const QMetaObject::Connection &connection : qAsConst(m_connections))
+        disconnect(connection);
+    m_connections.clear();
+    m_text = nullptr;
+    m_style = nullptr;
+}
+
+void QQuickMaterialCursor::updateVisible()
+{
+    setVisible(m_text && m_text->hasActiveFocus() && !hasSelection());
+}
+
+void QQuickMaterialCursor::updateColor()
+{
+    if (m_explicitColor || !m_style)
+        return;
+
+    const QColor color = m_style->accentColor();
+    if (m_color == color)
+        return;
+
+    m_color = color;
+    update();
+    emit colorChanged();
+}
+
+void QQuickMaterialCursor::updateClock()
+{
+    QQuickMaterialCursorClock *clock = nullptr;
+    if (isVisible() && window())
+        clock = QQuickMaterialCursorClock::get(window());
+    if (clock == m_clock)
+        return;
+
+    if (m_clock)
+        m_clock->remove(this);
+    m_clock = clock;
+    if (clock) {
+        // force the cursor visible when gaining focus
+        setOpacity(1.0);
+        clock->add(this);
+    }
+}
+
+void QQuickMaterialCursor::restart()
+{
+    // keep a moving cursor visible
+    setOpacity(1.0);
+    if (m_clock)
+        m_clock->restart();
+}
+
+bool QQuickMaterialCursor::hasSelection() const
+{
+    if (QQuickTextInput *input = qobject_cast<QQuickTextInput *>(m_text))
+        return input->selectionStart() != input->selectionEnd();
+    if (QQuickTextEdit *edit = qobject_cast<QQuickTextEdit *>(m_text))
+        return edit->selectionStart() != edit->selectionEnd();
+    return false;
+}
+
+QT_END_NAMESPACE
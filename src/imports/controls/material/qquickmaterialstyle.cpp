@@ -37,6 +37,7 @@
 #include "qquickmaterialstyle_p.h"
 
 #include <QtCore/qdebug.h>
+#include <QtCore/qhash.h>
 #include <QtCore/qsettings.h>
 #include <QtQml/qqmlinfo.h>
 #include <QtQuickControls2/private/qquickstyle_p.h>
@@ -426,6 +427,60 @@ static QQuickMaterialStyle::Theme effectiveTheme(QQuickMaterialStyle::Theme them
     return theme;
 }
 
+struct QQuickMaterialPaletteKey
+{
+    enum Flag {
+        CustomPrimary = 0x01,
+        CustomAccent = 0x02,
+        CustomBackground = 0x04,
+        HasForeground = 0x08,
+        HasBackground = 0x10,
+        ExplicitForeground = 0x20,
+        ExplicitBackground = 0x40,
+        Elevated = 0x80
+    };
+
+    QQuickMaterialStyle::Theme theme;
+    uint primary;
+    uint accent;
+    uint background;
+    uint flags;
+};
+
+static inline bool operator==(const QQuickMaterialPaletteKey &a, const QQuickMaterialPaletteKey &b)
+{
+    return a.theme == b.theme && a.primary == b.primary && a.accent == b.accent
+            && a.background == b.background && a.flags == b.flags;
+}
+
+static inline uint qHash(const QQuickMaterialPaletteKey &key, uint seed = 0)
+{
+    return qHash(key.primary, seed) ^ qHash(key.accent, seed) * 31 ^ qHash(key.background, seed) * 17
+            ^ (key.flags << 2 | key.theme);
+}
+
+class QQuickMaterialPalette;
+typedef QHash<QQuickMaterialPaletteKey, QQuickMaterialPalette *> QQuickMaterialPaletteHash;
+Q_GLOBAL_STATIC(QQuickMaterialPaletteHash, materialPalettes)
+
+// A resolved set of palette colors. All attached style objects that share the same
+// theme, colors and flags share a single palette, so the colors, some of which take
+// a round-trip through HSL to compute, are resolved only once per key. A palette
+// removes itself from the registry when the last style object referencing it lets go.
+class QQuickMaterialPalette : public QSharedData
+{
+public:
+    explicit QQuickMaterialPalette(const QQuickMaterialPaletteKey &key) : key(key) { }
+    ~QQuickMaterialPalette()
+    {
+        if (!materialPalettes.isDestroyed())
+            materialPalettes()->remove(key);
+    }
+
+    QQuickMaterialPaletteKey key;
+    QColor values[QQuickMaterialStyle::PaletteRoleCount];
+};
+
 QQuickMaterialStyle::QQuickMaterialStyle(QObject *parent) : QQuickAttachedObject(parent),
     m_explicitTheme(false),
     m_explicitPrimary(false),
@@ -446,6 +501,11 @@ QQuickMaterialStyle::QQuickMaterialStyle(QObject *parent) : QQuickAttachedObject
     m_elevation(0)
 {
     init();
+    updatePalette();
+}
+
+QQuickMaterialStyle::~QQuickMaterialStyle()
+{
 }
 
 QQuickMaterialStyle *QQuickMaterialStyle::qmlAttachedProperties(QObject *object)
@@ -470,7 +530,7 @@ void QQuickMaterialStyle::setTheme(Theme theme)
     m_theme = theme;
     propagateTheme();
     emit themeChanged();
-    emit paletteChanged();
+    updatePalette();
     if (!m_customAccent)
         emit accentChanged();
     if (!m_hasBackground)
@@ -487,7 +547,7 @@ void QQuickMaterialStyle::inheritTheme(Theme theme)
     m_theme = theme;
     propagateTheme();
     emit themeChanged();
-    emit paletteChanged();
+    updatePalette();
     if (!m_customAccent)
         emit accentChanged();
     if (!m_hasBackground)
@@ -536,7 +596,7 @@ void QQuickMaterialStyle::setPrimary(const QVariant &var)
     m_primary = primary;
     propagatePrimary();
     emit primaryChanged();
-    emit paletteChanged();
+    updatePalette();
 }
 
 void QQuickMaterialStyle::inheritPrimary(uint primary, bool custom)
@@ -548,7 +608,7 @@ void QQuickMaterialStyle::inheritPrimary(uint primary, bool custom)
     m_primary = primary;
     propagatePrimary();
     emit primaryChanged();
-    emit paletteChanged();
+    updatePalette();
 }
 
 void QQuickMaterialStyle::propagatePrimary()
@@ -595,7 +655,7 @@ void QQuickMaterialStyle::setAccent(const QVariant &var)
     m_accent = accent;
     propagateAccent();
     emit accentChanged();
-    emit paletteChanged();
+    updatePalette();
 }
 
 void QQuickMaterialStyle::inheritAccent(uint accent, bool custom)
@@ -607,7 +667,7 @@ void QQuickMaterialStyle::inheritAccent(uint accent, bool custom)
     m_accent = accent;
     propagateAccent();
     emit accentChanged();
-    emit paletteChanged();
+    updatePalette();
 }
 
 void QQuickMaterialStyle::propagateAccent()
@@ -654,13 +714,17 @@ void QQuickMaterialStyle::setForeground(const QVariant &var)
 
     m_hasForeground = true;
     m_explicitForeground = true;
-    if (m_foreground == foreground)
+    if (m_foreground == foreground) {
+        // the explicit flag alone affects some of the palette colors
+        updatePalette();
         return;
+    }
 
     m_customForeground = custom;
     m_foreground = foreground;
     propagateForeground();
     emit foregroundChanged();
+    updatePalette();
 }
 
 void QQuickMaterialStyle::inheritForeground(uint foreground, bool custom, bool has)
@@ -673,6 +737,7 @@ void QQuickMaterialStyle::inheritForeground(uint foreground, bool custom, bool h
     m_foreground = foreground;
     propagateForeground();
     emit foregroundChanged();
+    updatePalette();
 }
 
 void QQuickMaterialStyle::propagateForeground()
@@ -695,6 +760,7 @@ void QQuickMaterialStyle::resetForeground()
     m_explicitForeground = false;
     QQuickMaterialStyle *material = qobject_cast<QQuickMaterialStyle *>(attachedParent());
     inheritForeground(material ? material->m_foreground : globalForeground, true, material ? material->m_hasForeground : false);
+    updatePalette();
 }
 
 QVariant QQuickMaterialStyle::background() const
@@ -711,14 +777,17 @@ void QQuickMaterialStyle::setBackground(const QVariant &var)
 
     m_hasBackground = true;
     m_explicitBackground = true;
-    if (m_background == background)
+    if (m_background == background) {
+        // the explicit flag alone affects some of the palette colors
+        updatePalette();
         return;
+    }
 
     m_customBackground = custom;
     m_background = background;
     propagateBackground();
     emit backgroundChanged();
-    emit paletteChanged();
+    updatePalette();
 }
 
 void QQuickMaterialStyle::inheritBackground(uint background, bool custom, bool has)
@@ -731,7 +800,7 @@ void QQuickMaterialStyle::inheritBackground(uint background, bool custom, bool h
     m_background = background;
     propagateBackground();
     emit backgroundChanged();
-    emit paletteChanged();
+    updatePalette();
 }
 
 void QQuickMaterialStyle::propagateBackground()
@@ -754,6 +823,7 @@ void QQuickMaterialStyle::resetBackground()
     m_explicitBackground = false;
     QQuickMaterialStyle *material = qobject_cast<QQuickMaterialStyle *>(attachedParent());
     inheritBackground(material ? material->m_background : globalBackground, true, material ? material->m_hasBackground : false);
+    updatePalette();
 }
 
 int QQuickMaterialStyle::elevation() const
@@ -768,6 +838,7 @@ void QQuickMaterialStyle::setElevation(int elevation)
 
     m_elevation = elevation;
     emit elevationChanged();
+    updatePalette();
 }
 
 void QQuickMaterialStyle::resetElevation()
@@ -775,6 +846,85 @@ void QQuickMaterialStyle::resetElevation()
     setElevation(0);
 }
 
+void QQuickMaterialStyle::updatePalette()
+{
+    QQuickMaterialPaletteKey key;
+    key.theme = m_theme;
+    key.primary = m_primary;
+    key.accent = m_accent;
+    key.background = m_hasBackground ? m_background : 0;
+    key.flags = (m_customPrimary ? QQuickMaterialPaletteKey::CustomPrimary : 0)
+              | (m_customAccent ? QQuickMaterialPaletteKey::CustomAccent : 0)
+              | (m_hasBackground && m_customBackground ? QQuickMaterialPaletteKey::CustomBackground : 0)
+              | (m_hasForeground ? QQuickMaterialPaletteKey::HasForeground : 0)
+              | (m_hasBackground ? QQuickMaterialPaletteKey::HasBackground : 0)
+              | (m_explicitForeground ? QQuickMaterialPaletteKey::ExplicitForeground : 0)
+              | (m_explicitBackground ? QQuickMaterialPaletteKey::ExplicitBackground : 0)
+              | (m_elevation > 0 ? QQuickMaterialPaletteKey::Elevated : 0);
+
+    if (m_palette && m_palette->key == key)
+        return;
+
+    QQuickMaterialPalette *palette = materialPalettes()->value(key);
+    if (!palette) {
+        palette = new QQuickMaterialPalette(key);
+        for (int role = 0; role < PaletteRoleCount; ++role)
+            palette->values[role] = resolvePaletteColor(static_cast<PaletteRole>(role));
+        materialPalettes()->insert(key, palette);
+    }
+
+    QExplicitlySharedDataPointer<QQuickMaterialPalette> oldPalette = m_palette;
+    m_palette = palette;
+    if (!oldPalette)
+        return;
+
+    // must be kept in sync with the PaletteRole enum
+    static void (QQuickMaterialStyle::*const paletteSignals[PaletteRoleCount])() = {
+        &QQuickMaterialStyle::primaryTextColorChanged,
+        &QQuickMaterialStyle::primaryHighlightedTextColorChanged,
+        &QQuickMaterialStyle::secondaryTextColorChanged,
+        &QQuickMaterialStyle::hintTextColorChanged,
+        &QQuickMaterialStyle::textSelectionColorChanged,
+        &QQuickMaterialStyle::dropShadowColorChanged,
+        &QQuickMaterialStyle::dividerColorChanged,
+        &QQuickMaterialStyle::iconColorChanged,
+        &QQuickMaterialStyle::iconDisabledColorChanged,
+        &QQuickMaterialStyle::buttonColorChanged,
+        &QQuickMaterialStyle::buttonDisabledColorChanged,
+        &QQuickMaterialStyle::highlightedButtonColorChanged,
+        &QQuickMaterialStyle::frameColorChanged,
+        &QQuickMaterialStyle::rippleColorChanged,
+        &QQuickMaterialStyle::highlightedRippleColorChanged,
+        &QQuickMaterialStyle::switchUncheckedTrackColorChanged,
+        &QQuickMaterialStyle::switchCheckedTrackColorChanged,
+        &QQuickMaterialStyle::switchUncheckedHandleColorChanged,
+        &QQuickMaterialStyle::switchCheckedHandleColorChanged,
+        &QQuickMaterialStyle::switchDisabledTrackColorChanged,
+        &QQuickMaterialStyle::switchDisabledHandleColorChanged,
+        &QQuickMaterialStyle::scrollBarColorChanged,
+        &QQuickMaterialStyle::scrollBarHoveredColorChanged,
+        &QQuickMaterialStyle::scrollBarPressedColorChanged,
+        &QQuickMaterialStyle::dialogColorChanged,
+        &QQuickMaterialStyle::backgroundDimColorChanged,
+        &QQuickMaterialStyle::listHighlightColorChanged,
+        &QQuickMaterialStyle::tooltipColorChanged,
+        &QQuickMaterialStyle::toolBarColorChanged,
+        &QQuickMaterialStyle::toolTextColorChanged,
+        &QQuickMaterialStyle::spinBoxDisabledIconColorChanged
+    };
+
+    bool changed = false;
+    for (int role = 0; role < PaletteRoleCount; ++role) {
+        if (oldPalette->values[role] != palette->values[role]) {
+            emit (this->*paletteSignals[role])();
+            changed = true;
+        }
+    }
+
+    if (changed)
+        emit paletteChanged();
+}
+
 QColor QQuickMaterialStyle::primaryColor() const
 {
     if (m_customPrimary)
@@ -818,51 +968,47 @@ QColor QQuickMaterialStyle::backgroundColor() const
 
 QColor QQuickMaterialStyle::primaryTextColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? primaryTextColorLight : primaryTextColorDark);
+    return m_palette->values[PrimaryTextColor];
 }
 
 QColor QQuickMaterialStyle::primaryHighlightedTextColor() const
 {
-    if (m_explicitForeground)
-        return primaryTextColor();
-    return QColor::fromRgba(primaryTextColorDark);
+    return m_palette->values[PrimaryHighlightedTextColor];
 }
 
 QColor QQuickMaterialStyle::secondaryTextColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? secondaryTextColorLight : secondaryTextColorDark);
+    return m_palette->values[SecondaryTextColor];
 }
 
 QColor QQuickMaterialStyle::hintTextColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? hintTextColorLight : hintTextColorDark);
+    return m_palette->values[HintTextColor];
 }
 
 QColor QQuickMaterialStyle::textSelectionColor() const
 {
-    QColor color = accentColor();
-    color.setAlphaF(0.4);
-    return color;
+    return m_palette->values[TextSelectionColor];
 }
 
 QColor QQuickMaterialStyle::dropShadowColor() const
 {
-    return QColor::fromRgba(0x40000000);
+    return m_palette->values[DropShadowColor];
 }
 
 QColor QQuickMaterialStyle::dividerColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? dividerColorLight : dividerColorDark);
+    return m_palette->values[DividerColor];
 }
 
 QColor QQuickMaterialStyle::iconColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? iconColorLight : iconColorDark);
+    return m_palette->values[IconColor];
 }
 
 QColor QQuickMaterialStyle::iconDisabledColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? iconDisabledColorLight : iconDisabledColorDark);
+    return m_palette->values[IconDisabledColor];
 }
 
 QColor QQuickMaterialStyle::buttonColor(bool highlighted) const
@@ -885,158 +1031,236 @@ QColor QQuickMaterialStyle::buttonColor(bool highlighted) const
 
 QColor QQuickMaterialStyle::buttonColor() const
 {
-    return buttonColor(false);
+    return m_palette->values[ButtonColor];
 }
 
 QColor QQuickMaterialStyle::buttonDisabledColor() const
 {
-    if (elevation() > 0) {
-        return QColor::fromRgba(m_theme == Light ? raisedButtonDisabledColorLight
-                                                 : raisedButtonDisabledColorDark);
-    } else {
-        return Qt::transparent;
-    }
+    return m_palette->values[ButtonDisabledColor];
 }
 
 QColor QQuickMaterialStyle::highlightedButtonColor() const
 {
-    return buttonColor(true);
+    return m_palette->values[HighlightedButtonColor];
 }
 
 QColor QQuickMaterialStyle::frameColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? frameColorLight : frameColorDark);
+    return m_palette->values[FrameColor];
 }
 
 QColor QQuickMaterialStyle::rippleColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? rippleColorLight : rippleColorDark);
+    return m_palette->values[RippleColor];
 }
 
 QColor QQuickMaterialStyle::highlightedRippleColor() const
 {
-    QColor pressColor = accentColor();
-    pressColor.setAlpha(m_theme == Light ? 30 : 50);
-    return pressColor;
+    return m_palette->values[HighlightedRippleColor];
 }
 
 QColor QQuickMaterialStyle::switchUncheckedTrackColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? switchUncheckedTrackColorLight : switchUncheckedTrackColorDark);
+    return m_palette->values[SwitchUncheckedTrackColor];
 }
 
 QColor QQuickMaterialStyle::switchCheckedTrackColor() const
 {
-    QColor trackColor(accentColor());
-    trackColor.setAlphaF(0.5);
-    return trackColor;
+    return m_palette->values[SwitchCheckedTrackColor];
 }
 
 QColor QQuickMaterialStyle::switchUncheckedHandleColor() const
 {
-    return m_theme == Light ? color(Grey, Shade50) : color(Grey, Shade400);
+    return m_palette->values[SwitchUncheckedHandleColor];
 }
 
 QColor QQuickMaterialStyle::switchCheckedHandleColor() const
 {
-    return m_theme == Light ? accentColor() : shade(accentColor(), Shade200);
+    return m_palette->values[SwitchCheckedHandleColor];
 }
 
 QColor QQuickMaterialStyle::switchDisabledTrackColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? switchDisabledTrackColorLight : switchDisabledTrackColorDark);
+    return m_palette->values[SwitchDisabledTrackColor];
 }
 
 QColor QQuickMaterialStyle::switchDisabledHandleColor() const
 {
-    return m_theme == Light ? color(Grey, Shade400) : color(Grey, Shade800);
+    return m_palette->values[SwitchDisabledHandleColor];
 }
 
 QColor QQuickMaterialStyle::scrollBarColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? 0x40000000 : 0x40FFFFFF);
+    return m_palette->values[ScrollBarColor];
 }
 
 QColor QQuickMaterialStyle::scrollBarHoveredColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? 0x60000000 : 0x60FFFFFF);
+    return m_palette->values[ScrollBarHoveredColor];
 }
 
 QColor QQuickMaterialStyle::scrollBarPressedColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? 0x80000000 : 0x80FFFFFF);
+    return m_palette->values[ScrollBarPressedColor];
 }
 
 QColor QQuickMaterialStyle::dialogColor() const
 {
-    if (m_hasBackground)
-        return backgroundColor();
-    return QColor::fromRgba(m_theme == Light ? dialogColorLight : dialogColorDark);
+    return m_palette->values[DialogColor];
 }
 
 QColor QQuickMaterialStyle::backgroundDimColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? 0x99303030 : 0x99fafafa);
+    return m_palette->values[BackgroundDimColor];
 }
 
 QColor QQuickMaterialStyle::listHighlightColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? 0x1e000000 : 0x1effffff);
+    return m_palette->values[ListHighlightColor];
 }
 
 QColor QQuickMaterialStyle::tooltipColor() const
 {
-    if (m_explicitBackground)
-        return backgroundColor();
-    return color(Grey, Shade700);
+    return m_palette->values[TooltipColor];
 }
 
 QColor QQuickMaterialStyle::toolBarColor() const
 {
-    if (m_explicitBackground)
-        return backgroundColor();
-    return primaryColor();
+    return m_palette->values[ToolBarColor];
 }
 
 QColor QQuickMaterialStyle::toolTextColor() const
 {
-    if (m_hasForeground || m_customPrimary)
-        return primaryTextColor();
-
-    switch (m_primary) {
-    case Red:
-    case Pink:
-    case Purple:
-    case DeepPurple:
-    case Indigo:
-    case Blue:
-    case Teal:
-    case DeepOrange:
-    case Brown:
-    case BlueGrey:
-        return QColor::fromRgba(primaryTextColorDark);
-
-    case LightBlue:
-    case Cyan:
-    case Green:
-    case LightGreen:
-    case Lime:
-    case Yellow:
-    case Amber:
-    case Orange:
-    case Grey:
-        return QColor::fromRgba(primaryTextColorLight);
-
-    default:
-        break;
-    }
-
-    return primaryTextColor();
+    return m_palette->values[ToolTextColor];
 }
 
 QColor QQuickMaterialStyle::spinBoxDisabledIconColor() const
 {
-    return QColor::fromRgba(m_theme == Light ? spinBoxDisabledIconColorLight : spinBoxDisabledIconColorDark);
+    return m_palette->values[SpinBoxDisabledIconColor];
+}
+
+QColor QQuickMaterialStyle::resolvePaletteColor(PaletteRole role) const
+{
+    switch (role) {
+    case PrimaryTextColor:
+        return QColor::fromRgba(m_theme == Light ? primaryTextColorLight : primaryTextColorDark);
+    case PrimaryHighlightedTextColor:
+        if (m_explicitForeground)
+            return resolvePaletteColor(PrimaryTextColor);
+        return QColor::fromRgba(primaryTextColorDark);
+    case SecondaryTextColor:
+        return QColor::fromRgba(m_theme == Light ? secondaryTextColorLight : secondaryTextColorDark);
+    case HintTextColor:
+        return QColor::fromRgba(m_theme == Light ? hintTextColorLight : hintTextColorDark);
+    case TextSelectionColor: {
+        QColor color = accentColor();
+        color.setAlphaF(0.4);
+        return color;
+    }
+    case DropShadowColor:
+        return QColor::fromRgba(0x40000000);
+    case DividerColor:
+        return QColor::fromRgba(m_theme == Light ? dividerColorLight : dividerColorDark);
+    case IconColor:
+        return QColor::fromRgba(m_theme == Light ? iconColorLight : iconColorDark);
+    case IconDisabledColor:
+        return QColor::fromRgba(m_theme == Light ? iconDisabledColorLight : iconDisabledColorDark);
+    case ButtonColor:
+        return buttonColor(false);
+    case ButtonDisabledColor:
+        if (elevation() > 0) {
+            return QColor::fromRgba(m_theme == Light ? raisedButtonDisabledColorLight
+                                                     : raisedButtonDisabledColorDark);
+        }
+        return Qt::transparent;
+    case HighlightedButtonColor:
+        return buttonColor(true);
+    case FrameColor:
+        return QColor::fromRgba(m_theme == Light ? frameColorLight : frameColorDark);
+    case RippleColor:
+        return QColor::fromRgba(m_theme == Light ? rippleColorLight : rippleColorDark);
+    case HighlightedRippleColor: {
+        QColor pressColor = accentColor();
+        pressColor.setAlpha(m_theme == Light ? 30 : 50);
+        return pressColor;
+    }
+    case SwitchUncheckedTrackColor:
+        return QColor::fromRgba(m_theme == Light ? switchUncheckedTrackColorLight : switchUncheckedTrackColorDark);
+    case SwitchCheckedTrackColor: {
+        QColor trackColor(accentColor());
+        trackColor.setAlphaF(0.5);
+        return trackColor;
+    }
+    case SwitchUncheckedHandleColor:
+        return m_theme == Light ? color(Grey, Shade50) : color(Grey, Shade400);
+    case SwitchCheckedHandleColor:
+        return m_theme == Light ? accentColor() : shade(accentColor(), Shade200);
+    case SwitchDisabledTrackColor:
+        return QColor::fromRgba(m_theme == Light ? switchDisabledTrackColorLight : switchDisabledTrackColorDark);
+    case SwitchDisabledHandleColor:
+        return m_theme == Light ? color(Grey, Shade400) : color(Grey, Shade800);
+    case ScrollBarColor:
+        return QColor::fromRgba(m_theme == Light ? 0x40000000 : 0x40FFFFFF);
+    case ScrollBarHoveredColor:
+        return QColor::fromRgba(m_theme == Light ? 0x60000000 : 0x60FFFFFF);
+    case ScrollBarPressedColor:
+        return QColor::fromRgba(m_theme == Light ? 0x80000000 : 0x80FFFFFF);
+    case DialogColor:
+        if (m_hasBackground)
+            return backgroundColor();
+        return QColor::fromRgba(m_theme == Light ? dialogColorLight : dialogColorDark);
+    case BackgroundDimColor:
+        return QColor::fromRgba(m_theme == Light ? 0x99303030 : 0x99fafafa);
+    case ListHighlightColor:
+        return QColor::fromRgba(m_theme == Light ? 0x1e000000 : 0x1effffff);
+    case TooltipColor:
+        if (m_explicitBackground)
+            return backgroundColor();
+        return color(Grey, Shade700);
+    case ToolBarColor:
+        if (m_explicitBackground)
+            return backgroundColor();
+        return primaryColor();
+    case ToolTextColor: {
+        if (m_hasForeground || m_customPrimary)
+            return resolvePaletteColor(PrimaryTextColor);
+
+        switch (m_primary) {
+        case Red:
+        case Pink:
+        case Purple:
+        case DeepPurple:
+        case Indigo:
+        case Blue:
+        case Teal:
+        case DeepOrange:
+        case Brown:
+        case BlueGrey:
+            return QColor::fromRgba(primaryTextColorDark);
+
+        case LightBlue:
+        case Cyan:
+        case Green:
+        case LightGreen:
+        case Lime:
+        case Yellow:
+        case Amber:
+        case Orange:
+        case Grey:
+            return QColor::fromRgba(primaryTextColorLight);
+
+        default:
+            break;
+        }
+
+        return resolvePaletteColor(PrimaryTextColor);
+    }
+    case SpinBoxDisabledIconColor:
+        return QColor::fromRgba(m_theme == Light ? spinBoxDisabledIconColorLight : spinBoxDisabledIconColorDark);
+    default:
+        Q_UNREACHABLE();
+        return QColor();
+    }
 }
 
 QColor QQuickMaterialStyle::color(QQuickMaterialStyle::Color color, QQuickMaterialStyle::Shade shade) const
@@ -48,11 +48,14 @@
 // We mean it.
 //
 
+#include <QtCore/qshareddata.h>
 #include <QtGui/qcolor.h>
 #include <QtQuickControls2/private/qquickattachedobject_p.h>
 
 QT_BEGIN_NAMESPACE
 
+class QQuickMaterialPalette;
+
 class QQuickMaterialStyle : public QQuickAttachedObject
 {
     Q_OBJECT
@@ -66,37 +69,37 @@ class QQuickMaterialStyle : public QQuickAttachedObject
     Q_PROPERTY(QColor primaryColor READ primaryColor NOTIFY primaryChanged FINAL) // TODO: remove?
     Q_PROPERTY(QColor accentColor READ accentColor NOTIFY accentChanged FINAL) // TODO: remove?
     Q_PROPERTY(QColor backgroundColor READ backgroundColor NOTIFY backgroundChanged FINAL)
-    Q_PROPERTY(QColor primaryTextColor READ primaryTextColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor primaryHighlightedTextColor READ primaryHighlightedTextColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor secondaryTextColor READ secondaryTextColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor hintTextColor READ hintTextColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor textSelectionColor READ textSelectionColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor dropShadowColor READ dropShadowColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor dividerColor READ dividerColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor iconColor READ iconColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor iconDisabledColor READ iconDisabledColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor buttonColor READ buttonColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor buttonDisabledColor READ buttonDisabledColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor highlightedButtonColor READ highlightedButtonColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor frameColor READ frameColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor rippleColor READ rippleColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor highlightedRippleColor READ highlightedRippleColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor switchUncheckedTrackColor READ switchUncheckedTrackColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor switchCheckedTrackColor READ switchCheckedTrackColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor switchUncheckedHandleColor READ switchUncheckedHandleColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor switchCheckedHandleColor READ switchCheckedHandleColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor switchDisabledTrackColor READ switchDisabledTrackColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor switchDisabledHandleColor READ switchDisabledHandleColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor scrollBarColor READ scrollBarColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor scrollBarHoveredColor READ scrollBarHoveredColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor scrollBarPressedColor READ scrollBarPressedColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor dialogColor READ dialogColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor backgroundDimColor READ backgroundDimColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor listHighlightColor READ listHighlightColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor tooltipColor READ tooltipColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor toolBarColor READ toolBarColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor toolTextColor READ toolTextColor NOTIFY paletteChanged FINAL)
-    Q_PROPERTY(QColor spinBoxDisabledIconColor READ spinBoxDisabledIconColor NOTIFY paletteChanged FINAL)
+    Q_PROPERTY(QColor primaryTextColor READ primaryTextColor NOTIFY primaryTextColorChanged FINAL)
+    Q_PROPERTY(QColor primaryHighlightedTextColor READ primaryHighlightedTextColor NOTIFY primaryHighlightedTextColorChanged FINAL)
+    Q_PROPERTY(QColor secondaryTextColor READ secondaryTextColor NOTIFY secondaryTextColorChanged FINAL)
+    Q_PROPERTY(QColor hintTextColor READ hintTextColor NOTIFY hintTextColorChanged FINAL)
+    Q_PROPERTY(QColor textSelectionColor READ textSelectionColor NOTIFY textSelectionColorChanged FINAL)
+    Q_PROPERTY(QColor dropShadowColor READ dropShadowColor NOTIFY dropShadowColorChanged FINAL)
+    Q_PROPERTY(QColor dividerColor READ dividerColor NOTIFY dividerColorChanged FINAL)
+    Q_PROPERTY(QColor iconColor READ iconColor NOTIFY iconColorChanged FINAL)
+    Q_PROPERTY(QColor iconDisabledColor READ iconDisabledColor NOTIFY iconDisabledColorChanged FINAL)
+    Q_PROPERTY(QColor buttonColor READ buttonColor NOTIFY buttonColorChanged FINAL)
+    Q_PROPERTY(QColor buttonDisabledColor READ buttonDisabledColor NOTIFY buttonDisabledColorChanged FINAL)
+    Q_PROPERTY(QColor highlightedButtonColor READ highlightedButtonColor NOTIFY highlightedButtonColorChanged FINAL)
+    Q_PROPERTY(QColor frameColor READ frameColor NOTIFY frameColorChanged FINAL)
+    Q_PROPERTY(QColor rippleColor READ rippleColor NOTIFY rippleColorChanged FINAL)
+    Q_PROPERTY(QColor highlightedRippleColor READ highlightedRippleColor NOTIFY highlightedRippleColorChanged FINAL)
+    Q_PROPERTY(QColor switchUncheckedTrackColor READ switchUncheckedTrackColor NOTIFY switchUncheckedTrackColorChanged FINAL)
+    Q_PROPERTY(QColor switchCheckedTrackColor READ switchCheckedTrackColor NOTIFY switchCheckedTrackColorChanged FINAL)
+    Q_PROPERTY(QColor switchUncheckedHandleColor READ switchUncheckedHandleColor NOTIFY switchUncheckedHandleColorChanged FINAL)
+    Q_PROPERTY(QColor switchCheckedHandleColor READ switchCheckedHandleColor NOTIFY switchCheckedHandleColorChanged FINAL)
+    Q_PROPERTY(QColor switchDisabledTrackColor READ switchDisabledTrackColor NOTIFY switchDisabledTrackColorChanged FINAL)
+    Q_PROPERTY(QColor switchDisabledHandleColor READ switchDisabledHandleColor NOTIFY switchDisabledHandleColorChanged FINAL)
+    Q_PROPERTY(QColor scrollBarColor READ scrollBarColor NOTIFY scrollBarColorChanged FINAL)
+    Q_PROPERTY(QColor scrollBarHoveredColor READ scrollBarHoveredColor NOTIFY scrollBarHoveredColorChanged FINAL)
+    Q_PROPERTY(QColor scrollBarPressedColor READ scrollBarPressedColor NOTIFY scrollBarPressedColorChanged FINAL)
+    Q_PROPERTY(QColor dialogColor READ dialogColor NOTIFY dialogColorChanged FINAL)
+    Q_PROPERTY(QColor backgroundDimColor READ backgroundDimColor NOTIFY backgroundDimColorChanged FINAL)
+    Q_PROPERTY(QColor listHighlightColor READ listHighlightColor NOTIFY listHighlightColorChanged FINAL)
+    Q_PROPERTY(QColor tooltipColor READ tooltipColor NOTIFY tooltipColorChanged FINAL)
+    Q_PROPERTY(QColor toolBarColor READ toolBarColor NOTIFY toolBarColorChanged FINAL)
+    Q_PROPERTY(QColor toolTextColor READ toolTextColor NOTIFY toolTextColorChanged FINAL)
+    Q_PROPERTY(QColor spinBoxDisabledIconColor READ spinBoxDisabledIconColor NOTIFY spinBoxDisabledIconColorChanged FINAL)
 
 public:
     enum Theme {
@@ -149,6 +152,7 @@ public:
     Q_ENUM(Shade)
 
     explicit QQuickMaterialStyle(QObject *parent = nullptr);
+    ~QQuickMaterialStyle();
 
     static QQuickMaterialStyle *qmlAttachedProperties(QObject *object);
 
@@ -234,18 +238,88 @@ Q_SIGNALS:
     void elevationChanged();
 
     void paletteChanged();
+    void primaryTextColorChanged();
+    void primaryHighlightedTextColorChanged();
+    void secondaryTextColorChanged();
+    void hintTextColorChanged();
+    void textSelectionColorChanged();
+    void dropShadowColorChanged();
+    void dividerColorChanged();
+    void iconColorChanged();
+    void iconDisabledColorChanged();
+    void buttonColorChanged();
+    void buttonDisabledColorChanged();
+    void highlightedButtonColorChanged();
+    void frameColorChanged();
+    void rippleColorChanged();
+    void highlightedRippleColorChanged();
+    void switchUncheckedTrackColorChanged();
+    void switchCheckedTrackColorChanged();
+    void switchUncheckedHandleColorChanged();
+    void switchCheckedHandleColorChanged();
+    void switchDisabledTrackColorChanged();
+    void switchDisabledHandleColorChanged();
+    void scrollBarColorChanged();
+    void scrollBarHoveredColorChanged();
+    void scrollBarPressedColorChanged();
+    void dialogColorChanged();
+    void backgroundDimColorChanged();
+    void listHighlightColorChanged();
+    void tooltipColorChanged();
+    void toolBarColorChanged();
+    void toolTextColorChanged();
+    void spinBoxDisabledIconColorChanged();
 
 protected:
     void attachedParentChange(QQuickAttachedObject *newParent, QQuickAttachedObject *oldParent) override;
 
 private:
+    friend class QQuickMaterialPalette;
+
+    enum PaletteRole {
+        PrimaryTextColor = 0,
+        PrimaryHighlightedTextColor,
+        SecondaryTextColor,
+        HintTextColor,
+        TextSelectionColor,
+        DropShadowColor,
+        DividerColor,
+        IconColor,
+        IconDisabledColor,
+        ButtonColor,
+        ButtonDisabledColor,
+        HighlightedButtonColor,
+        FrameColor,
+        RippleColor,
+        HighlightedRippleColor,
+        SwitchUncheckedTrackColor,
+        SwitchCheckedTrackColor,
+        SwitchUncheckedHandleColor,
+        SwitchCheckedHandleColor,
+        SwitchDisabledTrackColor,
+        SwitchDisabledHandleColor,
+        ScrollBarColor,
+        ScrollBarHoveredColor,
+        ScrollBarPressedColor,
+        DialogColor,
+        BackgroundDimColor,
+        ListHighlightColor,
+        TooltipColor,
+        ToolBarColor,
+        ToolTextColor,
+        SpinBoxDisabledIconColor,
+        PaletteRoleCount
+    };
+
     void init();
+    void updatePalette();
     bool variantToRgba(const QVariant &var, const char *name, QRgb *rgba, bool *custom) const;
 
     QColor backgroundColor(Shade shade) const;
     QColor accentColor(Shade shade) const;
     QColor buttonColor(bool highlighted) const;
     Shade themeShade() const;
+    QColor resolvePaletteColor(PaletteRole role) const;
 
     // These reflect whether a color value was explicitly set on the specific
     // item that this attached style object represents.
@@ -274,6 +348,9 @@ private:
     uint m_foreground;
     uint m_background;
     int m_elevation;
+    // The colors resolved from the values above. Palettes are interned, so all
+    // attached style objects that resolve to the same key share a single instance.
+    QExplicitlySharedDataPointer<QQuickMaterialPalette> m_palette;
 };
 
 QT_END_NAMESPACE
@@ -36,13 +36,18 @@
 
 #include "qquickmaterialtheme_p.h"
 
+#include <QtCore/qdir.h>
+#include <QtCore/qdiriterator.h>
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qsettings.h>
+#include <QtCore/qstandardpaths.h>
 #include <QtGui/qfont.h>
 #include <QtGui/qfontinfo.h>
+#include <QtQuickControls2/private/qquickstyle_p.h>
 
 QT_BEGIN_NAMESPACE
 
-QQuickMaterialTheme::QQuickMaterialTheme(QPlatformTheme *theme)
-    : QQuickProxyTheme(theme)
+static QString detectFontFamily()
 {
     QFont font;
     font.setFamily(QLatin1String("Roboto"));
@@ -53,16 +58,79 @@ QQuickMaterialTheme::QQuickMaterialTheme(QPlatformTheme *theme)
         family = QFontInfo(font).family();
     }
 
-    if (family == QLatin1String("Roboto") || family == QLatin1String("Noto")) {
-        systemFont.setFamily(family);
-        buttonFont.setFamily(family);
-        toolTipFont.setFamily(family);
-        itemViewFont.setFamily(family);
-        listViewFont.setFamily(family);
-        menuItemFont.setFamily(family);
-        editorFont.setFamily(family);
+    if (family == QLatin1String("Roboto") || family == QLatin1String("Noto"))
+        return family;
+    return QString();
+}
+
+#if QT_CONFIG(settings) && defined(Q_OS_UNIX) && !defined(Q_OS_DARWIN) && !defined(Q_OS_ANDROID)
+static qint64 lastModified(const QString &path)
+{
+    // Installing a font typically adds a sub-directory or a file to one of
+    // the immediate sub-directories of a font directory, so look one level deep.
+    qint64 timestamp = QFileInfo(path).lastModified().toMSecsSinceEpoch();
+    QDirIterator it(path, QDir::Dirs | QDir::NoDotAndDotDot);
+    while (it.hasNext()) {
+        it.next();
+        timestamp = qMax(timestamp, it.fileInfo().lastModified().toMSecsSinceEpoch());
     }
+    return timestamp;
+}
+
+// Identifies the state of the fontconfig configuration and font directories. Fontconfig
+// rescans whenever any of these change, and so must the font family detection.
+static QString fontCacheKey()
+{
+    const QString home = QDir::homePath();
+    const QString paths[] = {
+        QStringLiteral("/etc/fonts"),
+        QStandardPaths::writableLocation(QStandardPaths::GenericConfigLocation) + QLatin1String("/fontconfig"),
+        QStringLiteral("/usr/share/fonts"),
+        QStringLiteral("/usr/local/share/fonts"),
+        home + QLatin1String("/.fonts"),
+        home + QLatin1String("/.local/share/fonts")
+    };
+
+    QStringList key(QLatin1String(QT_VERSION_STR));
+    for (const QString &path : paths)
+        key += QString::number(lastModified(path));
+    return key.join(QLatin1Char(':'));
+}
+
+static QString fontCacheFilePath()
+{
+    const QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (cacheDir.isEmpty())
+        return QString();
+    return cacheDir + QLatin1String("/qtquickcontrols2/material.conf");
+}
+
+static QString cachedFontFamily()
+{
+    const QString filePath = fontCacheFilePath();
+    if (filePath.isEmpty())
+        return detectFontFamily();
 
+    QSettings cache(filePath, QSettings::IniFormat);
+    const QString key = fontCacheKey();
+    if (cache.value(QStringLiteral("FontCacheKey")).toString() == key)
+        return cache.value(QStringLiteral("FontFamily")).toString();
+
+    const QString family = detectFontFamily();
+    cache.setValue(QStringLiteral("FontCacheKey"), key);
+    cache.setValue(QStringLiteral("FontFamily"), family);
+    return family;
+}
+#else
+static QString cachedFontFamily()
+{
+    return detectFontFamily();
+}
+#endif
+
+QQuickMaterialTheme::QQuickMaterialTheme(QPlatformTheme *theme)
+    : QQuickProxyTheme(theme), fontFamilyResolved(false)
+{
     systemFont.setPixelSize(14);
 
     buttonFont.setPixelSize(14);
@@ -82,8 +150,37 @@ QQuickMaterialTheme::QQuickMaterialTheme(QPlatformTheme *theme)
     editorFont.setPixelSize(16);
 }
 
+void QQuickMaterialTheme::resolveFontFamily() const
+{
+    fontFamilyResolved = true;
+
+    QString family = QString::fromLocal8Bit(qgetenv("QT_QUICK_CONTROLS_MATERIAL_FONT_FAMILY"));
+#if QT_CONFIG(settings)
+    if (family.isEmpty()) {
+        QSharedPointer<QSettings> settings = QQuickStylePrivate::settings(QStringLiteral("Material"));
+        if (!settings.isNull())
+            family = settings->value(QStringLiteral("FontFamily")).toString();
+    }
+#endif
+    if (family.isEmpty())
+        family = cachedFontFamily();
+    if (family.isEmpty())
+        return;
+
+    systemFont.setFamily(family);
+    buttonFont.setFamily(family);
+    toolTipFont.setFamily(family);
+    itemViewFont.setFamily(family);
+    listViewFont.setFamily(family);
+    menuItemFont.setFamily(family);
+    editorFont.setFamily(family);
+}
+
 const QFont *QQuickMaterialTheme::font(QPlatformTheme::Font type) const
 {
+    if (!fontFamilyResolved)
+        resolveFontFamily();
+
     switch (type) {
     case QPlatformTheme::TabButtonFont:
     case QPlatformTheme::PushButtonFont:
@@ -61,13 +61,18 @@ public:
     const QFont *font(Font type = SystemFont) const override;
 
 private:
-    QFont systemFont;
-    QFont buttonFont;
-    QFont toolTipFont;
-    QFont itemViewFont;
-    QFont listViewFont;
-    QFont menuItemFont;
-    QFont editorFont;
+    void resolveFontFamily() const;
+
+    // The family is resolved on the first font request, because matching
+    // the preferred families against the font database is expensive.
+    mutable bool fontFamilyResolved;
+    mutable QFont systemFont;
+    mutable QFont buttonFont;
+    mutable QFont toolTipFont;
+    mutable QFont itemViewFont;
+    mutable QFont listViewFont;
+    mutable QFont menuItemFont;
+    mutable QFont editorFont;
 };
 
 QT_END_NAMESPACE
@@ -39,6 +39,8 @@
 #include "qquickmaterialstyle_p.h"
 #include "qquickmaterialtheme_p.h"
 #include "qquickmaterialbusyindicator_p.h"
+#include "qquickmaterialcontrolbackground_p.h"
+#include "qquickmaterialcursor_p.h"
 #include "qquickmaterialprogressbar_p.h"
 #include "qquickmaterialripple_p.h"
 
@@ -93,16 +95,18 @@ void QtQuickControls2MaterialStylePlugin::initializeEngine(QQmlEngine *engine, c
 
     qmlRegisterType<QQuickPaddedRectangle>(import, 2, 0, "PaddedRectangle");
     qmlRegisterType<QQuickMaterialBusyIndicator>(import, 2, 0, "BusyIndicatorImpl");
+    qmlRegisterType<QQuickMaterialCursor>(import, 2, 0, "CursorDelegate");
     qmlRegisterType<QQuickMaterialProgressBar>(import, 2, 0, "ProgressBarImpl");
     qmlRegisterType<QQuickMaterialRipple>(import, 2, 0, "Ripple");
     qmlRegisterType(typeUrl(QStringLiteral("BoxShadow.qml")), import, 2, 0, "BoxShadow");
     qmlRegisterType(typeUrl(QStringLiteral("CheckIndicator.qml")), import, 2, 0, "CheckIndicator");
-    qmlRegisterType(typeUrl(QStringLiteral("CursorDelegate.qml")), import, 2, 0, "CursorDelegate");
     qmlRegisterType(typeUrl(QStringLiteral("ElevationEffect.qml")), import, 2, 0, "ElevationEffect");
     qmlRegisterType(typeUrl(QStringLiteral("RadioIndicator.qml")), import, 2, 0, "RadioIndicator");
     qmlRegisterType(typeUrl(QStringLiteral("RectangularGlow.qml")), import, 2, 0, "RectangularGlow");
     qmlRegisterType(typeUrl(QStringLiteral("SliderHandle.qml")), import, 2, 0, "SliderHandle");
     qmlRegisterType(typeUrl(QStringLiteral("SwitchIndicator.qml")), import, 2, 0, "SwitchIndicator");
+
+    qmlRegisterType<QQuickMaterialControlBackground>(import, 2, 3, "ControlBackground");
 }
 
 QString QtQuickControls2MaterialStylePlugin::name() const
@@ -39,6 +39,7 @@ import QtQuick.Templates 2.3 as T
 import QtQuick.Controls 2.3
 import QtQuick.Controls.impl 2.3
 import QtQuick.Controls.Universal 2.3
+import QtQuick.Controls.Universal.impl 2.3
 
 T.Button {
     id: control
@@ -83,22 +84,10 @@ T.Button {
         }
     }
 
-    background: Rectangle {
+    background: ControlBackground {
         implicitWidth: 32
         implicitHeight: 32
 
-        visible: !control.flat || control.down || control.checked || control.highlighted
-        color: control.down ? control.Universal.baseMediumLowColor :
-               control.enabled && (control.highlighted || control.checked) ? control.Universal.accent :
-                                                                             control.Universal.baseLowColor
-
-        Rectangle {
-            width: parent.width
-            height: parent.height
-            color: "transparent"
-            visible: control.hovered
-            border.width: 2 // ButtonBorderThemeThickness
-            border.color: control.Universal.baseMediumLowColor
-        }
+        control: control
     }
 }
@@ -60,14 +60,16 @@ T.SpinBox {
 
     Universal.theme: activeFocus ? Universal.Light : undefined
 
-    validator: IntValidator {
+    validator: DoubleValidator {
         locale: control.locale.name
-        bottom: Math.min(control.from, control.to)
-        top: Math.max(control.from, control.to)
+        bottom: Math.min(control.from, control.to) / Math.pow(10, control.decimals)
+        top: Math.max(control.from, control.to) / Math.pow(10, control.decimals)
+        decimals: control.decimals
+        notation: DoubleValidator.StandardNotation
     }
 
     contentItem: TextInput {
-        text: control.textFromValue(control.value, control.locale)
+        text: control.displayText
 
         font: control.font
         color: !enabled ? control.Universal.chromeDisabledLowColor :
@@ -37,6 +37,7 @@
 import QtQuick 2.9
 import QtQuick.Templates 2.3 as T
 import QtQuick.Controls.Universal 2.3
+import QtQuick.Controls.Universal.impl 2.3
 
 T.SwitchDelegate {
     id: control
@@ -75,17 +76,7 @@ T.SwitchDelegate {
         color: control.Universal.foreground
     }
 
-    background: Rectangle {
-        visible: control.down || control.highlighted || control.visualFocus || control.hovered
-        color: control.down ? control.Universal.listMediumColor :
-               control.hovered ? control.Universal.listLowColor : control.Universal.altMediumLowColor
-        Rectangle {
-            width: parent.width
-            height: parent.height
-            visible: control.visualFocus || control.highlighted
-            color: control.Universal.accent
-            opacity: control.Universal.theme === Universal.Light ? 0.4 : 0.6
-        }
-
+    background: ControlBackground {
+        control: control
     }
 }
@@ -39,16 +39,17 @@ import QtQuick.Templates 2.3 as T
 import QtQuick.Controls 2.3
 import QtQuick.Controls.impl 2.3
 import QtQuick.Controls.Universal 2.3
+import QtQuick.Controls.Universal.impl 2.3
 
 T.TextArea {
     id: control
 
     implicitWidth: Math.max(contentWidth + leftPadding + rightPadding,
                             background ? background.implicitWidth : 0,
-                            placeholder.implicitWidth + leftPadding + rightPadding)
+                            implicitPlaceholderWidth + leftPadding + rightPadding)
     implicitHeight: Math.max(contentHeight + topPadding + bottomPadding,
                              background ? background.implicitHeight : 0,
-                             placeholder.implicitHeight + topPadding + bottomPadding)
+                             implicitPlaceholderHeight + topPadding + bottomPadding)
 
     // TextControlThemePadding + 2 (border)
     padding: 12
@@ -61,31 +62,14 @@ T.TextArea {
     color: !enabled ? Universal.chromeDisabledLowColor : Universal.foreground
     selectionColor: Universal.accent
     selectedTextColor: Universal.chromeWhiteColor
+    placeholderTextColor: !enabled ? Universal.chromeDisabledLowColor :
+                          activeFocus ? Universal.chromeBlackMediumLowColor : Universal.baseMediumColor
+    placeholderItemEnabled: true
 
-    PlaceholderText {
-        id: placeholder
-        x: control.leftPadding
-        y: control.topPadding
-        width: control.width - (control.leftPadding + control.rightPadding)
-        height: control.height - (control.topPadding + control.bottomPadding)
-
-        text: control.placeholderText
-        font: control.font
-        color: !control.enabled ? control.Universal.chromeDisabledLowColor :
-                control.activeFocus ? control.Universal.chromeBlackMediumLowColor : control.Universal.baseMediumColor
-        visible: !control.length && !control.preeditText && (!control.activeFocus || control.horizontalAlignment !== Qt.AlignHCenter)
-        verticalAlignment: control.verticalAlignment
-        elide: Text.ElideRight
-    }
-
-    background: Rectangle {
+    background: ControlBackground {
         implicitWidth: 60 // TextControlThemeMinWidth - 4 (border)
         implicitHeight: 28 // TextControlThemeMinHeight - 4 (border)
 
-        border.width: 2 // TextControlBorderThemeThickness
-        border.color: !control.enabled ? control.Universal.baseLowColor :
-                       control.activeFocus ? control.Universal.accent :
-                       control.hovered ? control.Universal.baseMediumColor : control.Universal.chromeDisabledLowColor
-        color: control.enabled ? control.Universal.background : control.Universal.baseLowColor
+        control: control
     }
 }
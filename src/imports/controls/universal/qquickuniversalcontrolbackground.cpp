@@ -0,0 +1,117 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickuniversalcontrolbackground_p.h"
+#include "qquickuniversalstyle_p.h"
+
+#include <QtQuickTemplates2/private/qquickbutton_p.h>
+#include <QtQuickTemplates2/private/qquickitemdelegate_p.h>
+
+QT_BEGIN_NAMESPACE
+
+static const qreal ButtonBorderThemeThickness = 2;
+static const qreal TextControlBorderThemeThickness = 2;
+
+QQuickUniversalControlBackground::QQuickUniversalControlBackground(QQuickItem *parent) :
+    QQuickControlBackground(parent)
+{
+}
+
+void QQuickUniversalControlBackground::controlChange(QQuickItem *newControl, QQuickItem *oldControl)
+{
+    Q_UNUSED(oldControl);
+    if (m_style)
+        disconnect(m_style, nullptr, this, nullptr);
+
+    m_style = newControl ? qobject_cast<QQuickUniversalStyle *>(qmlAttachedPropertiesObject<QQuickUniversalStyle>(newControl)) : nullptr;
+    if (m_style) {
+        connect(m_style, &QQuickUniversalStyle::themeChanged, this, &QQuickUniversalControlBackground::invalidate);
+        connect(m_style, &QQuickUniversalStyle::paletteChanged, this, &QQuickUniversalControlBackground::invalidate);
+        connect(m_style, &QQuickUniversalStyle::accentChanged, this, &QQuickUniversalControlBackground::invalidate);
+        connect(m_style, &QQuickUniversalStyle::backgroundChanged, this, &QQuickUniversalControlBackground::invalidate);
+    }
+}
+
+void QQuickUniversalControlBackground::updateBackground(States states)
+{
+    if (!m_style)
+        return;
+
+    setRect(boundingRect());
+
+    const QColor accent = m_style->accent().value<QColor>();
+    if (qobject_cast<QQuickButton *>(control())) {
+        if ((states & Flat) && !(states & (Down | Checked | Highlighted))) {
+            setColor(Qt::transparent);
+            setBorder(0, Qt::transparent);
+            return;
+        }
+
+        const QColor color = states & Down ? m_style->baseMediumLowColor()
+                           : (states & Enabled) && (states & (Highlighted | Checked)) ? accent
+                           : m_style->baseLowColor();
+        setColor(color);
+        if (states & Hovered)
+            setBorder(ButtonBorderThemeThickness, blend(m_style->baseMediumLowColor(), color));
+        else
+            setBorder(0, color);
+    } else if (qobject_cast<QQuickItemDelegate *>(control())) {
+        if (!(states & (Down | Highlighted | VisualFocus | Hovered))) {
+            setColor(Qt::transparent);
+            return;
+        }
+
+        QColor color = states & Down ? m_style->listMediumColor()
+                     : states & Hovered ? m_style->listLowColor()
+                     : m_style->altMediumLowColor();
+        if (states & (VisualFocus | Highlighted)) {
+            QColor highlight = accent;
+            highlight.setAlphaF(highlight.alphaF() * (m_style->theme() == QQuickUniversalStyle::Light ? 0.4 : 0.6));
+            color = blend(highlight, color);
+        }
+        setColor(color);
+    } else {
+        // text controls
+        const QColor borderColor = !(states & Enabled) ? m_style->baseLowColor()
+                                 : states & ActiveFocus ? accent
+                                 : states & Hovered ? m_style->baseMediumColor()
+                                 : m_style->chromeDisabledLowColor();
+        setBorder(TextControlBorderThemeThickness, borderColor);
+        setColor(states & Enabled ? m_style->background().value<QColor>() : m_style->baseLowColor());
+    }
+}
+
+QT_END_NAMESPACE
@@ -37,6 +37,7 @@
 #include <QtQuickControls2/private/qquickstyleplugin_p.h>
 
 #include "qquickuniversalbusyindicator_p.h"
+#include "qquickuniversalcontrolbackground_p.h"
 #include "qquickuniversalfocusrectangle_p.h"
 #include "qquickuniversalprogressbar_p.h"
 #include "qquickuniversalstyle_p.h"
@@ -96,6 +97,8 @@ void QtQuickControls2UniversalStylePlugin::initializeEngine(QQmlEngine *engine,
     qmlRegisterType(typeUrl(QStringLiteral("CheckIndicator.qml")), import, 2, 0, "CheckIndicator");
     qmlRegisterType(typeUrl(QStringLiteral("RadioIndicator.qml")), import, 2, 0, "RadioIndicator");
     qmlRegisterType(typeUrl(QStringLiteral("SwitchIndicator.qml")), import, 2, 0, "SwitchIndicator");
+
+    qmlRegisterType<QQuickUniversalControlBackground>(import, 2, 3, "ControlBackground");
 }
 
 QString QtQuickControls2UniversalStylePlugin::name() const
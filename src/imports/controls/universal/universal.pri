@@ -49,6 +49,7 @@ QML_FILES += \
 
 HEADERS += \
     $$PWD/qquickuniversalbusyindicator_p.h \
+    $$PWD/qquickuniversalcontrolbackground_p.h \
     $$PWD/qquickuniversalfocusrectangle_p.h \
     $$PWD/qquickuniversalprogressbar_p.h \
     $$PWD/qquickuniversalstyle_p.h \
@@ -56,6 +57,7 @@ HEADERS += \
 
 SOURCES += \
     $$PWD/qquickuniversalbusyindicator.cpp \
+    $$PWD/qquickuniversalcontrolbackground.cpp \
     $$PWD/qquickuniversalfocusrectangle.cpp \
     $$PWD/qquickuniversalprogressbar.cpp \
     $$PWD/qquickuniversalstyle.cpp \
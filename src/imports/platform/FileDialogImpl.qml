@@ -0,0 +1,241 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Labs Platform module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.9
+import QtQuick.Window 2.2
+import Qt.labs.platform 1.0
+
+// The QML implementation of FileDialog, used when there is neither a native
+// file dialog nor a QApplication to fall back to the Qt Widgets based file dialog.
+// The dialog helper is accessible through the "dialog" context property.
+Window {
+    id: window
+
+    width: 480
+    height: 360
+    title: dialog.title
+    color: palette.window
+
+    readonly property url currentFile: dialog.currentFiles.length > 0 ? dialog.currentFiles[0] : ""
+
+    function open(index) {
+        if (folderModel.isFolder(index)) {
+            dialog.folder = folderModel.fileUrl(index)
+        } else {
+            dialog.currentFiles = [folderModel.fileUrl(index)]
+            dialog.accept()
+        }
+    }
+
+    function accept() {
+        if (!dialog.selectExisting && fileNameInput.text.length > 0)
+            dialog.currentFiles = [dialog.folder + "/" + fileNameInput.text]
+        if (dialog.currentFiles.length > 0)
+            dialog.accept()
+    }
+
+    function nextNameFilter() {
+        var index = dialog.nameFilters.indexOf(dialog.selectedNameFilter)
+        dialog.selectedNameFilter = dialog.nameFilters[(index + 1) % dialog.nameFilters.length]
+    }
+
+    SystemPalette { id: palette }
+
+    FolderModel {
+        id: folderModel
+        folder: dialog.folder
+        nameFilters: dialog.selectedNameFilter.length > 0 ? [dialog.selectedNameFilter] : dialog.nameFilters
+    }
+
+    Row {
+        id: header
+        x: 6
+        y: 6
+        width: parent.width - 12
+        height: upButton.height
+        spacing: 6
+
+        Rectangle {
+            id: upButton
+            width: height
+            height: upText.implicitHeight + 8
+            color: upArea.pressed ? palette.mid : palette.button
+            border.color: palette.mid
+            opacity: enabled ? 1.0 : 0.5
+            enabled: folderModel.parentFolder.toString().length > 0
+
+            Text {
+                id: upText
+                anchors.centerIn: parent
+                text: "↑"
+                color: palette.buttonText
+            }
+
+            MouseArea {
+                id: upArea
+                anchors.fill: parent
+                onClicked: dialog.folder = folderModel.parentFolder
+            }
+        }
+
+        Text {
+            width: parent.width - x
+            anchors.verticalCenter: parent.verticalCenter
+            text: folderModel.folder.toString().replace(/^file:\/\//, "")
+            elide: Text.ElideMiddle
+            color: palette.windowText
+        }
+    }
+
+    ListView {
+        id: listView
+        clip: true
+        focus: true
+        anchors.fill: parent
+        anchors.topMargin: header.height + 12
+        anchors.bottomMargin: footer.height + 12
+        model: folderModel
+        currentIndex: -1
+        boundsBehavior: Flickable.StopAtBounds
+
+        delegate: Rectangle {
+            width: listView.width
+            height: label.implicitHeight + 8
+            color: ListView.isCurrentItem ? palette.highlight : "transparent"
+
+            Text {
+                id: label
+                x: 6
+                width: parent.width - 12
+                anchors.verticalCenter: parent.verticalCenter
+                text: fileIsDir ? fileName + "/" : fileName
+                elide: Text.ElideRight
+                color: parent.ListView.isCurrentItem ? palette.highlightedText : palette.text
+            }
+
+            MouseArea {
+                anchors.fill: parent
+                onClicked: {
+                    listView.currentIndex = index
+                    if (!fileIsDir) {
+                        dialog.currentFiles = [fileUrl]
+                        fileNameInput.text = fileName
+                    }
+                }
+                onDoubleClicked: window.open(index)
+            }
+        }
+
+        Keys.onReturnPressed: if (currentIndex !== -1) window.open(currentIndex)
+        Keys.onEscapePressed: dialog.reject()
+
+        Text {
+            anchors.centerIn: parent
+            visible: folderModel.status === FolderModel.Loading && folderModel.count === 0
+            text: qsTr("Loading...")
+            color: palette.windowText
+        }
+    }
+
+    Column {
+        id: footer
+        x: 6
+        width: parent.width - 12
+        anchors.bottom: parent.bottom
+        anchors.bottomMargin: 6
+        spacing: 6
+
+        Rectangle {
+            visible: !dialog.selectExisting
+            width: parent.width
+            height: fileNameInput.implicitHeight + 8
+            color: palette.base
+            border.color: palette.mid
+
+            TextInput {
+                id: fileNameInput
+                x: 4
+                width: parent.width - 8
+                anchors.verticalCenter: parent.verticalCenter
+                color: palette.text
+                clip: true
+                onAccepted: window.accept()
+            }
+        }
+
+        Row {
+            spacing: 6
+            layoutDirection: Qt.RightToLeft
+            width: parent.width
+
+            Repeater {
+                model: [
+                    { action: "accept", text: dialog.acceptLabel.length > 0 ? dialog.acceptLabel : dialog.selectExisting ? qsTr("Open") : qsTr("Save") },
+                    { action: "reject", text: dialog.rejectLabel.length > 0 ? dialog.rejectLabel : qsTr("Cancel") },
+                    { action: "filter", text: dialog.selectedNameFilter.length > 0 ? dialog.selectedNameFilter : dialog.nameFilters.length > 0 ? dialog.nameFilters[0] : "" }
+                ]
+
+                Rectangle {
+                    width: buttonText.implicitWidth + 24
+                    height: buttonText.implicitHeight + 8
+                    visible: modelData.action !== "filter" || dialog.nameFilters.length > 1
+                    color: buttonArea.pressed ? palette.mid : palette.button
+                    border.color: palette.mid
+
+                    Text {
+                        id: buttonText
+                        anchors.centerIn: parent
+                        text: modelData.text
+                        color: palette.buttonText
+                    }
+
+                    MouseArea {
+                        id: buttonArea
+                        anchors.fill: parent
+                        onClicked: {
+                            if (modelData.action === "accept")
+                                window.accept()
+                            else if (modelData.action === "reject")
+                                dialog.reject()
+                            else
+                                window.nextNameFilter()
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -2,7 +2,9 @@ HEADERS += \
     $$PWD/qquickplatformcolordialog_p.h \
     $$PWD/qquickplatformdialog_p.h \
     $$PWD/qquickplatformfiledialog_p.h \
+    $$PWD/qquickplatformfiledialoghelper_p.h \
     $$PWD/qquickplatformfolderdialog_p.h \
+    $$PWD/qquickplatformfoldermodel_p.h \
     $$PWD/qquickplatformfontdialog_p.h \
     $$PWD/qquickplatformiconloader_p.h \
     $$PWD/qquickplatformmenu_p.h \
@@ -11,13 +13,16 @@ HEADERS += \
     $$PWD/qquickplatformmenuitemgroup_p.h \
     $$PWD/qquickplatformmenuseparator_p.h \
     $$PWD/qquickplatformmessagedialog_p.h \
+    $$PWD/qquickplatformnamefiltermatcher_p.h \
     $$PWD/qquickplatformstandardpaths_p.h
 
 SOURCES += \
     $$PWD/qquickplatformcolordialog.cpp \
     $$PWD/qquickplatformdialog.cpp \
     $$PWD/qquickplatformfiledialog.cpp \
+    $$PWD/qquickplatformfiledialoghelper.cpp \
     $$PWD/qquickplatformfolderdialog.cpp \
+    $$PWD/qquickplatformfoldermodel.cpp \
     $$PWD/qquickplatformfontdialog.cpp \
     $$PWD/qquickplatformiconloader.cpp \
     $$PWD/qquickplatformmenu.cpp \
@@ -26,6 +31,7 @@ SOURCES += \
     $$PWD/qquickplatformmenuitemgroup.cpp \
     $$PWD/qquickplatformmenuseparator.cpp \
     $$PWD/qquickplatformmessagedialog.cpp \
+    $$PWD/qquickplatformnamefiltermatcher.cpp \
     $$PWD/qquickplatformstandardpaths.cpp
 
 
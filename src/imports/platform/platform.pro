@@ -12,6 +12,9 @@ QMAKE_DOCS = $$PWD/doc/qtlabsplatform.qdocconf
 OTHER_FILES += \
     qmldir
 
+QML_FILES += \
+    $$PWD/FileDialogImpl.qml
+
 SOURCES += \
     $$PWD/qtlabsplatformplugin.cpp
 
@@ -352,6 +352,8 @@ bool QQuickPlatformDialog::create()
     if (!m_handle) {
         if (useNativeDialog())
             m_handle = QGuiApplicationPrivate::platformTheme()->createPlatformDialogHelper(m_type);
+        if (!m_handle && !qApp->inherits("QApplication"))
+            m_handle = createQuickDialog();
         if (!m_handle)
             m_handle = QWidgetPlatform::createDialog(m_type, this);
         qCDebug(qtLabsPlatformDialogs) << qmlTypeName(this) << "->" << m_handle;
@@ -376,6 +378,11 @@ bool QQuickPlatformDialog::useNativeDialog() const
             && QGuiApplicationPrivate::platformTheme()->usePlatformNativeDialog(m_type);
 }
 
+QPlatformDialogHelper *QQuickPlatformDialog::createQuickDialog()
+{
+    return nullptr;
+}
+
 void QQuickPlatformDialog::onCreate(QPlatformDialogHelper *dialog)
 {
     Q_UNUSED(dialog);
@@ -127,6 +127,7 @@ protected:
     void destroy();
 
     virtual bool useNativeDialog() const;
+    virtual QPlatformDialogHelper *createQuickDialog();
     virtual void onCreate(QPlatformDialogHelper *dialog);
     virtual void onShow(QPlatformDialogHelper *dialog);
     virtual void onHide(QPlatformDialogHelper *dialog);
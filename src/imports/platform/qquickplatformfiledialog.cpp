@@ -35,6 +35,7 @@
 ****************************************************************************/
 
 #include "qquickplatformfiledialog_p.h"
+#include "qquickplatformfiledialoghelper_p.h"
 
 #include <QtCore/qvector.h>
 
@@ -91,9 +92,13 @@ QT_BEGIN_NAMESPACE
 
     \input includes/widgets.qdocinc 1
 
+    When the application uses \l QGuiApplication instead, FileDialog falls back
+    to a file dialog implemented in QML. It lists the folder contents with a
+    \l FolderModel, which enumerates folders in a worker thread.
+
     \labs
 
-    \sa FolderDialog, StandardPaths
+    \sa FolderDialog, FolderModel, StandardPaths
 */
 
 QQuickPlatformFileDialog::QQuickPlatformFileDialog(QObject *parent)
@@ -503,6 +508,11 @@ bool QQuickPlatformFileDialog::useNativeDialog() const
             && !m_options->testOption(QFileDialogOptions::DontUseNativeDialog);
 }
 
+QPlatformDialogHelper *QQuickPlatformFileDialog::createQuickDialog()
+{
+    return new QQuickPlatformFileDialogHelper(this);
+}
+
 void QQuickPlatformFileDialog::onCreate(QPlatformDialogHelper *dialog)
 {
     if (QPlatformFileDialogHelper *fileDialog = qobject_cast<QPlatformFileDialogHelper *>(dialog)) {
@@ -632,15 +642,21 @@ void QQuickPlatformFileNameFilter::update(const QString &filter)
     const QStringList filters = nameFilters();
 
     const int oldIndex = m_index;
+    m_index = filters.indexOf(filter);
+    if (oldIndex != m_index)
+        emit indexChanged(m_index);
+
+    // the name and the extensions only need to be parsed when the filter changes
+    if (m_filter == filter)
+        return;
+
     const QString oldName = m_name;
     const QStringList oldExtensions = m_extensions;
 
-    m_index = filters.indexOf(filter);
+    m_filter = filter;
     m_name = extractName(filter);
     m_extensions = extractExtensions(filter);
 
-    if (oldIndex != m_index)
-        emit indexChanged(m_index);
     if (oldName != m_name)
         emit nameChanged(m_name);
     if (oldExtensions != m_extensions)
@@ -138,6 +138,7 @@ Q_SIGNALS:
 
 protected:
     bool useNativeDialog() const override;
+    QPlatformDialogHelper *createQuickDialog() override;
     void onCreate(QPlatformDialogHelper *dialog) override;
     void onShow(QPlatformDialogHelper *dialog) override;
     void onHide(QPlatformDialogHelper *dialog) override;
@@ -184,6 +185,7 @@ private:
     QString nameFilter(int index) const;
 
     int m_index;
+    QString m_filter;
     QString m_name;
     QStringList m_extensions;
     QSharedPointer<QFileDialogOptions> m_options;
@@ -0,0 +1,212 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Labs Platform module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickplatformfiledialoghelper_p.h"
+
+#include <QtCore/qeventloop.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtGui/qwindow.h>
+#include <QtQml/qqmlcomponent.h>
+#include <QtQml/qqmlcontext.h>
+#include <QtQml/qqmlengine.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(qtLabsPlatformDialogs)
+
+Q_GLOBAL_STATIC(QUrl, fileDialogImplementationUrl)
+
+QQuickPlatformFileDialogHelper::QQuickPlatformFileDialogHelper(QObject *parent)
+{
+    setParent(parent);
+}
+
+QQuickPlatformFileDialogHelper::~QQuickPlatformFileDialogHelper()
+{
+    delete m_window;
+}
+
+QUrl QQuickPlatformFileDialogHelper::implementationUrl()
+{
+    return *fileDialogImplementationUrl();
+}
+
+void QQuickPlatformFileDialogHelper::setImplementationUrl(const QUrl &url)
+{
+    *fileDialogImplementationUrl() = url;
+}
+
+QString QQuickPlatformFileDialogHelper::title() const
+{
+    return options()->windowTitle();
+}
+
+bool QQuickPlatformFileDialogHelper::selectExisting() const
+{
+    return options()->acceptMode() == QFileDialogOptions::AcceptOpen;
+}
+
+bool QQuickPlatformFileDialogHelper::selectMultiple() const
+{
+    return options()->fileMode() == QFileDialogOptions::ExistingFiles;
+}
+
+QString QQuickPlatformFileDialogHelper::acceptLabel() const
+{
+    return options()->labelText(QFileDialogOptions::Accept);
+}
+
+QString QQuickPlatformFileDialogHelper::rejectLabel() const
+{
+    return options()->labelText(QFileDialogOptions::Reject);
+}
+
+QStringList QQuickPlatformFileDialogHelper::nameFilters() const
+{
+    return options()->nameFilters();
+}
+
+void QQuickPlatformFileDialogHelper::setCurrentFiles(const QList<QUrl> &files)
+{
+    if (m_currentFiles == files)
+        return;
+
+    m_currentFiles = files;
+    emit currentFilesChanged();
+    emit currentChanged(files.value(0));
+}
+
+bool QQuickPlatformFileDialogHelper::defaultNameFilterDisables() const
+{
+    return false;
+}
+
+void QQuickPlatformFileDialogHelper::setDirectory(const QUrl &directory)
+{
+    if (m_folder == directory)
+        return;
+
+    m_folder = directory;
+    emit folderChanged();
+    emit directoryEntered(directory);
+}
+
+QUrl QQuickPlatformFileDialogHelper::directory() const
+{
+    return m_folder;
+}
+
+void QQuickPlatformFileDialogHelper::selectFile(const QUrl &filename)
+{
+    setCurrentFiles(QList<QUrl>() << filename);
+}
+
+QList<QUrl> QQuickPlatformFileDialogHelper::selectedFiles() const
+{
+    return m_currentFiles;
+}
+
+void QQuickPlatformFileDialogHelper::setFilter()
+{
+}
+
+void QQuickPlatformFileDialogHelper::selectNameFilter(const QString &filter)
+{
+    if (m_selectedNameFilter == filter)
+        return;
+
+    m_selectedNameFilter = filter;
+    emit selectedNameFilterChanged();
+    emit filterSelected(filter);
+}
+
+QString QQuickPlatformFileDialogHelper::selectedNameFilter() const
+{
+    return m_selectedNameFilter;
+}
+
+void QQuickPlatformFileDialogHelper::exec()
+{
+    QEventLoop loop;
+    connect(this, &QPlatformDialogHelper::accept, &loop, &QEventLoop::quit);
+    connect(this, &QPlatformDialogHelper::reject, &loop, &QEventLoop::quit);
+    loop.exec();
+}
+
+bool QQuickPlatformFileDialogHelper::show(Qt::WindowFlags flags, Qt::WindowModality modality, QWindow *parent)
+{
+    if (!m_window && !createWindow())
+        return false;
+
+    emit optionsChanged();
+
+    m_window->setFlags(flags);
+    m_window->setModality(modality);
+    m_window->setTransientParent(parent);
+    m_window->show();
+    return true;
+}
+
+void QQuickPlatformFileDialogHelper::hide()
+{
+    if (m_window)
+        m_window->hide();
+}
+
+bool QQuickPlatformFileDialogHelper::createWindow()
+{
+    QQmlContext *parentContext = qmlContext(parent());
+    if (!parentContext) {
+        qCWarning(qtLabsPlatformDialogs) << "FileDialog: cannot create a QML file dialog without a QML context";
+        return false;
+    }
+
+    QQmlComponent component(parentContext->engine(), implementationUrl());
+    QQmlContext *context = new QQmlContext(parentContext, this);
+    context->setContextProperty(QStringLiteral("dialog"), this);
+
+    QObject *object = component.create(context);
+    m_window = qobject_cast<QWindow *>(object);
+    if (!m_window) {
+        qCWarning(qtLabsPlatformDialogs) << "FileDialog: cannot create a QML file dialog:" << component.errors();
+        delete object;
+        delete context;
+        return false;
+    }
+    return true;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,121 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Labs Platform module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QQUICKPLATFORMFILEDIALOGHELPER_P_H
+#define QQUICKPLATFORMFILEDIALOGHELPER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qpointer.h>
+#include <QtGui/qpa/qplatformdialoghelper.h>
+
+QT_BEGIN_NAMESPACE
+
+class QWindow;
+
+// A file dialog helper whose user interface is implemented in QML. It is used
+// when there is neither a native file dialog nor a QApplication to fall back to
+// the Qt Widgets based file dialog. The QML implementation is a Window that
+// accesses the helper through the "dialog" context property.
+class QQuickPlatformFileDialogHelper : public QPlatformFileDialogHelper
+{
+    Q_OBJECT
+    Q_PROPERTY(QString title READ title NOTIFY optionsChanged FINAL)
+    Q_PROPERTY(bool selectExisting READ selectExisting NOTIFY optionsChanged FINAL)
+    Q_PROPERTY(bool selectMultiple READ selectMultiple NOTIFY optionsChanged FINAL)
+    Q_PROPERTY(QString acceptLabel READ acceptLabel NOTIFY optionsChanged FINAL)
+    Q_PROPERTY(QString rejectLabel READ rejectLabel NOTIFY optionsChanged FINAL)
+    Q_PROPERTY(QStringList nameFilters READ nameFilters NOTIFY optionsChanged FINAL)
+    Q_PROPERTY(QString selectedNameFilter READ selectedNameFilter WRITE selectNameFilter NOTIFY selectedNameFilterChanged FINAL)
+    Q_PROPERTY(QUrl folder READ directory WRITE setDirectory NOTIFY folderChanged FINAL)
+    Q_PROPERTY(QList<QUrl> currentFiles READ selectedFiles WRITE setCurrentFiles NOTIFY currentFilesChanged FINAL)
+
+public:
+    explicit QQuickPlatformFileDialogHelper(QObject *parent = nullptr);
+    ~QQuickPlatformFileDialogHelper();
+
+    static QUrl implementationUrl();
+    static void setImplementationUrl(const QUrl &url);
+
+    QString title() const;
+    bool selectExisting() const;
+    bool selectMultiple() const;
+    QString acceptLabel() const;
+    QString rejectLabel() const;
+    QStringList nameFilters() const;
+
+    void setCurrentFiles(const QList<QUrl> &files);
+
+    bool defaultNameFilterDisables() const override;
+    void setDirectory(const QUrl &directory) override;
+    QUrl directory() const override;
+    void selectFile(const QUrl &filename) override;
+    QList<QUrl> selectedFiles() const override;
+    void setFilter() override;
+    void selectNameFilter(const QString &filter) override;
+    QString selectedNameFilter() const override;
+
+    void exec() override;
+    bool show(Qt::WindowFlags flags, Qt::WindowModality modality, QWindow *parent) override;
+    void hide() override;
+
+Q_SIGNALS:
+    void optionsChanged();
+    void selectedNameFilterChanged();
+    void folderChanged();
+    void currentFilesChanged();
+
+private:
+    bool createWindow();
+
+    QUrl m_folder;
+    QList<QUrl> m_currentFiles;
+    QString m_selectedNameFilter;
+    QPointer<QWindow> m_window;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKPLATFORMFILEDIALOGHELPER_P_H
@@ -0,0 +1,580 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Labs Platform module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickplatformfoldermodel_p.h"
+#include "qquickplatformnamefiltermatcher_p.h"
+
+#include <QtCore/qcache.h>
+#include <QtCore/qcollator.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qdiriterator.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qthread.h>
+
+#include <algorithm>
+#include <numeric>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \qmltype FolderModel
+    \inherits QAbstractListModel
+    \instantiates QQuickPlatformFolderModel
+    \inqmlmodule Qt.labs.platform
+    \since 5.10
+    \brief A model of the contents of a local folder.
+
+    The FolderModel type provides a model of the files and sub-folders of a
+    local \l folder. The folder is enumerated in a worker thread, and the
+    entries are added to the model in batches as they are found, so that
+    browsing folders with a large number of entries does not block the user
+    interface. Once the enumeration has finished, the entries are sorted in
+    the worker thread, folders first, and the model is re-ordered in one go.
+
+    The contents of recently visited folders are cached. Revisiting such a
+    folder populates the model immediately from the cache, and the folder is
+    re-enumerated in the background to pick up any changes.
+
+    The following roles are available to delegates: \c fileName, \c filePath,
+    \c fileUrl, \c fileSize, \c fileModified and \c fileIsDir.
+
+    \code
+    ListView {
+        model: FolderModel {
+            folder: StandardPaths.writableLocation(StandardPaths.PicturesLocation)
+            nameFilters: ["Images (*.png *.jpg)"]
+        }
+        delegate: Text { text: fileName }
+    }
+    \endcode
+
+    \labs
+*/
+
+enum {
+    ScanBatchSize = 256, // entries
+    ScanBatchInterval = 50, // ms
+    FolderCacheCost = 256 * 1024 // entries
+};
+
+typedef QCache<QString, QQuickPlatformFolderEntryList> QQuickPlatformFolderCache;
+Q_GLOBAL_STATIC_WITH_ARGS(QQuickPlatformFolderCache, folderCache, (FolderCacheCost))
+
+class QQuickPlatformFolderScanner : public QObject
+{
+    Q_OBJECT
+
+public:
+    void cancel(int generation);
+    void scan(int generation, const QString &path, const QQuickPlatformNameFilterMatcher &matcher, QDir::Filters filters, bool stream);
+
+Q_SIGNALS:
+    void entriesAdded(int generation, const QQuickPlatformFolderEntryList &entries);
+    void scanFinished(int generation, const QQuickPlatformFolderEntryList &entries, const QVector<int> &order);
+
+private:
+    bool isCanceled(int generation) const;
+
+    // The generation of the scan that the model is waiting for. Written by the
+    // GUI thread, so that an ongoing scan of a folder that is no longer needed
+    // bails out without waiting for the enumeration to finish.
+    QAtomicInt m_generation;
+};
+
+void QQuickPlatformFolderScanner::cancel(int generation)
+{
+    m_generation.store(generation);
+}
+
+bool QQuickPlatformFolderScanner::isCanceled(int generation) const
+{
+    return m_generation.load() != generation;
+}
+
+void QQuickPlatformFolderScanner::scan(int generation, const QString &path, const QQuickPlatformNameFilterMatcher &matcher, QDir::Filters filters, bool stream)
+{
+    QQuickPlatformFolderEntryList entries;
+    QQuickPlatformFolderEntryList batch;
+    QElapsedTimer timer;
+    timer.start();
+
+    QDirIterator it(path, filters | QDir::NoDotAndDotDot);
+    while (it.hasNext()) {
+        if (isCanceled(generation))
+            return;
+
+        it.next();
+        const QFileInfo info = it.fileInfo();
+        const bool dir = info.isDir();
+        if (!dir && !matcher.matches(info.fileName()))
+            continue;
+
+        QQuickPlatformFolderEntry entry = { info.fileName(), dir ? 0 : info.size(), info.lastModified(), dir };
+        entries += entry;
+
+        if (stream) {
+            batch += entry;
+            if (batch.count() >= ScanBatchSize || timer.elapsed() >= ScanBatchInterval) {
+                emit entriesAdded(generation, batch);
+                batch.clear();
+                timer.restart();
+            }
+        }
+    }
+
+    if (stream && !batch.isEmpty())
+        emit entriesAdded(generation, batch);
+
+    QCollator collator;
+    collator.setNumericMode(true);
+    collator.setCaseSensitivity(Qt::CaseInsensitive);
+
+    QVector<QCollatorSortKey> keys;
+    keys.reserve(entries.count());
+    for (const QQuickPlatformFolderEntry &entry : qAsConst(entries))
+        keys += collator.sortKey(entry.name);
+
+    // order[row] is the index of the entry in the enumeration order
+    QVector<int> order(entries.count());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        if (entries.at(a).dir != entries.at(b).dir)
+            return entries.at(a).dir;
+        return keys.at(a).compare(keys.at(b)) < 0;
+    });
+
+    if (isCanceled(generation))
+        return;
+
+    QQuickPlatformFolderEntryList sorted;
+    sorted.reserve(entries.count());
+    for (int index : qAsConst(order))
+        sorted += entries.at(index);
+
+    emit scanFinished(generation, sorted, order);
+}
+
+QQuickPlatformFolderModel::QQuickPlatformFolderModel(QObject *parent)
+    : QAbstractListModel(parent),
+      m_complete(true),
+      m_showDirs(true),
+      m_showFiles(true),
+      m_showHidden(false),
+      m_revalidating(false),
+      m_status(Null),
+      m_generation(0),
+      m_thread(nullptr),
+      m_scanner(nullptr)
+{
+    qRegisterMetaType<QQuickPlatformFolderEntryList>();
+    qRegisterMetaType<QVector<int> >();
+}
+
+QQuickPlatformFolderModel::~QQuickPlatformFolderModel()
+{
+    if (m_thread) {
+        m_scanner->cancel(-1);
+        m_thread->quit();
+        m_thread->wait();
+        delete m_scanner;
+    }
+}
+
+/*!
+    \qmlproperty url Qt.labs.platform::FolderModel::folder
+
+    This property holds the local folder whose contents are listed.
+*/
+QUrl QQuickPlatformFolderModel::folder() const
+{
+    return m_folder;
+}
+
+void QQuickPlatformFolderModel::setFolder(const QUrl &folder)
+{
+    if (m_folder == folder)
+        return;
+
+    m_folder = folder;
+    m_path = folder.isLocalFile() ? QDir::cleanPath(folder.toLocalFile()) : QString();
+    refresh();
+    emit folderChanged();
+}
+
+/*!
+    \qmlproperty url Qt.labs.platform::FolderModel::parentFolder
+    \readonly
+
+    This property holds the parent of the current \l folder, or an
+    empty url if the folder is a root folder.
+*/
+QUrl QQuickPlatformFolderModel::parentFolder() const
+{
+    const int slash = m_path.lastIndexOf(QLatin1Char('/'));
+    if (slash == -1 || slash == m_path.length() - 1)
+        return QUrl();
+
+    QString parentPath = m_path.left(qMax(1, slash));
+    if (parentPath.endsWith(QLatin1Char(':')))
+        parentPath += QLatin1Char('/');
+    return QUrl::fromLocalFile(parentPath);
+}
+
+/*!
+    \qmlproperty list<string> Qt.labs.platform::FolderModel::nameFilters
+
+    This property holds the name filters that files must match. Each filter
+    can be either a plain wildcard pattern, such as \c "*.txt", or a filter
+    in the format used by \l FileDialog::nameFilters, such as
+    \c "Images (*.png *.jpg)". Folders are not filtered.
+
+    The filters are compiled once when the property is assigned.
+*/
+QStringList QQuickPlatformFolderModel::nameFilters() const
+{
+    return m_nameFilters;
+}
+
+void QQuickPlatformFolderModel::setNameFilters(const QStringList &filters)
+{
+    if (m_nameFilters == filters)
+        return;
+
+    m_nameFilters = filters;
+    refresh();
+    emit nameFiltersChanged();
+}
+
+/*!
+    \qmlproperty bool Qt.labs.platform::FolderModel::showDirs
+
+    This property holds whether sub-folders are listed. The default value is \c true.
+*/
+bool QQuickPlatformFolderModel::showDirs() const
+{
+    return m_showDirs;
+}
+
+void QQuickPlatformFolderModel::setShowDirs(bool show)
+{
+    if (m_showDirs == show)
+        return;
+
+    m_showDirs = show;
+    refresh();
+    emit showDirsChanged();
+}
+
+/*!
+    \qmlproperty bool Qt.labs.platform::FolderModel::showFiles
+
+    This property holds whether files are listed. The default value is \c true.
+*/
+bool QQuickPlatformFolderModel::showFiles() const
+{
+    return m_showFiles;
+}
+
+void QQuickPlatformFolderModel::setShowFiles(bool show)
+{
+    if (m_showFiles == show)
+        return;
+
+    m_showFiles = show;
+    refresh();
+    emit showFilesChanged();
+}
+
+/*!
+    \qmlproperty bool Qt.labs.platform::FolderModel::showHidden
+
+    This property holds whether hidden files and folders are listed. The default value is \c false.
+*/
+bool QQuickPlatformFolderModel::showHidden() const
+{
+    return m_showHidden;
+}
+
+void QQuickPlatformFolderModel::setShowHidden(bool show)
+{
+    if (m_showHidden == show)
+        return;
+
+    m_showHidden = show;
+    refresh();
+    emit showHiddenChanged();
+}
+
+/*!
+    \qmlproperty enumeration Qt.labs.platform::FolderModel::status
+    \readonly
+
+    This property holds the status of the model.
+
+    \value FolderModel.Null No folder has been set.
+    \value FolderModel.Loading The folder is being enumerated. Entries are added as they are found.
+    \value FolderModel.Ready The folder has been enumerated and the entries have been sorted.
+*/
+QQuickPlatformFolderModel::Status QQuickPlatformFolderModel::status() const
+{
+    return m_status;
+}
+
+/*!
+    \qmlproperty int Qt.labs.platform::FolderModel::count
+    \readonly
+
+    This property holds the number of entries in the model.
+*/
+int QQuickPlatformFolderModel::count() const
+{
+    return m_entries.count();
+}
+
+int QQuickPlatformFolderModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid())
+        return 0;
+    return m_entries.count();
+}
+
+QVariant QQuickPlatformFolderModel::data(const QModelIndex &index, int role) const
+{
+    if (index.row() < 0 || index.row() >= m_entries.count())
+        return QVariant();
+
+    const QQuickPlatformFolderEntry &entry = m_entries.at(index.row());
+    switch (role) {
+    case Qt::DisplayRole:
+    case FileNameRole:
+        return entry.name;
+    case FilePathRole:
+        return QDir(m_path).filePath(entry.name);
+    case FileUrlRole:
+        return QUrl::fromLocalFile(QDir(m_path).filePath(entry.name));
+    case FileSizeRole:
+        return entry.size;
+    case FileModifiedRole:
+        return entry.lastModified;
+    case FileIsDirRole:
+        return entry.dir;
+    default:
+        return QVariant();
+    }
+}
+
+QHash<int, QByteArray> QQuickPlatformFolderModel::roleNames() const
+{
+    QHash<int, QByteArray> roles;
+    roles.insert(FileNameRole, "fileName");
+    roles.insert(FilePathRole, "filePath");
+    roles.insert(FileUrlRole, "fileUrl");
+    roles.insert(FileSizeRole, "fileSize");
+    roles.insert(FileModifiedRole, "fileModified");
+    roles.insert(FileIsDirRole, "fileIsDir");
+    return roles;
+}
+
+/*!
+    \qmlmethod url Qt.labs.platform::FolderModel::fileUrl(int index)
+
+    Returns the url of the entry at \a index.
+*/
+QUrl QQuickPlatformFolderModel::fileUrl(int index) const
+{
+    if (index < 0 || index >= m_entries.count())
+        return QUrl();
+    return QUrl::fromLocalFile(QDir(m_path).filePath(m_entries.at(index).name));
+}
+
+/*!
+    \qmlmethod bool Qt.labs.platform::FolderModel::isFolder(int index)
+
+    Returns \c true if the entry at \a index is a folder.
+*/
+bool QQuickPlatformFolderModel::isFolder(int index) const
+{
+    return index >= 0 && index < m_entries.count() && m_entries.at(index).dir;
+}
+
+void QQuickPlatformFolderModel::classBegin()
+{
+    m_complete = false;
+}
+
+void QQuickPlatformFolderModel::componentComplete()
+{
+    m_complete = true;
+    refresh();
+}
+
+void QQuickPlatformFolderModel::refresh()
+{
+    if (!m_complete)
+        return;
+
+    const int generation = ++m_generation;
+    if (m_scanner)
+        m_scanner->cancel(generation);
+
+    const int oldCount = m_entries.count();
+
+    beginResetModel();
+    m_entries.clear();
+    m_revalidating = false;
+    if (!m_path.isEmpty()) {
+        if (const QQuickPlatformFolderEntryList *cached = folderCache()->object(cacheKey())) {
+            m_entries = *cached;
+            m_revalidating = true;
+        }
+    }
+    endResetModel();
+
+    if (oldCount != m_entries.count())
+        emit countChanged();
+
+    if (m_path.isEmpty()) {
+        setStatus(Null);
+        return;
+    }
+
+    setStatus(m_revalidating ? Ready : Loading);
+
+    if (!m_thread) {
+        m_thread = new QThread(this);
+        m_scanner = new QQuickPlatformFolderScanner;
+        m_scanner->moveToThread(m_thread);
+        connect(m_scanner, &QQuickPlatformFolderScanner::entriesAdded, this, &QQuickPlatformFolderModel::entriesAdded);
+        connect(m_scanner, &QQuickPlatformFolderScanner::scanFinished, this, &QQuickPlatformFolderModel::scanFinished);
+        m_thread->start(QThread::LowPriority);
+        m_scanner->cancel(generation);
+    }
+
+    QDir::Filters filters = 0;
+    if (m_showDirs)
+        filters |= QDir::AllDirs;
+    if (m_showFiles)
+        filters |= QDir::Files;
+    if (m_showHidden)
+        filters |= QDir::Hidden;
+
+#if defined(Q_OS_WIN) || defined(Q_OS_DARWIN)
+    const Qt::CaseSensitivity cs = Qt::CaseInsensitive;
+#else
+    const Qt::CaseSensitivity cs = Qt::CaseSensitive;
+#endif
+
+    const QString path = m_path;
+    const QQuickPlatformNameFilterMatcher matcher(m_nameFilters, cs);
+    const bool stream = !m_revalidating;
+    QQuickPlatformFolderScanner *scanner = m_scanner;
+    QMetaObject::invokeMethod(m_scanner, [=]() {
+        scanner->scan(generation, path, matcher, filters, stream);
+    }, Qt::QueuedConnection);
+}
+
+void QQuickPlatformFolderModel::setStatus(Status status)
+{
+    if (m_status == status)
+        return;
+
+    m_status = status;
+    emit statusChanged();
+}
+
+QString QQuickPlatformFolderModel::cacheKey() const
+{
+    QString key = m_path;
+    key += QLatin1Char('\n') + m_nameFilters.join(QLatin1Char('\n'));
+    key += QLatin1Char('\n') + QString::number(m_showDirs) + QString::number(m_showFiles) + QString::number(m_showHidden);
+    return key;
+}
+
+void QQuickPlatformFolderModel::entriesAdded(int generation, const QQuickPlatformFolderEntryList &entries)
+{
+    if (generation != m_generation || m_revalidating)
+        return;
+
+    const int count = m_entries.count();
+    beginInsertRows(QModelIndex(), count, count + entries.count() - 1);
+    m_entries += entries;
+    endInsertRows();
+    emit countChanged();
+}
+
+void QQuickPlatformFolderModel::scanFinished(int generation, const QQuickPlatformFolderEntryList &entries, const QVector<int> &order)
+{
+    if (generation != m_generation)
+        return;
+
+    folderCache()->insert(cacheKey(), new QQuickPlatformFolderEntryList(entries), qMax(1, entries.count()));
+
+    if (m_revalidating) {
+        // the model was populated from the cache; only reset if the folder has changed since
+        m_revalidating = false;
+        if (m_entries != entries) {
+            const int oldCount = m_entries.count();
+            beginResetModel();
+            m_entries = entries;
+            endResetModel();
+            if (oldCount != m_entries.count())
+                emit countChanged();
+        }
+    } else {
+        // the streamed entries are in enumeration order; re-order them in one go
+        emit layoutAboutToBeChanged();
+        const QModelIndexList from = persistentIndexList();
+        if (!from.isEmpty()) {
+            QVector<int> rows(order.count());
+            for (int row = 0; row < order.count(); ++row)
+                rows[order.at(row)] = row;
+
+            QModelIndexList to;
+            to.reserve(from.count());
+            for (const QModelIndex &index : from)
+                to += index.row() < rows.count() ? this->index(rows.at(index.row())) : QModelIndex();
+            changePersistentIndexList(from, to);
+        }
+        m_entries = entries;
+        emit layoutChanged();
+    }
+
+    setStatus(Ready);
+}
+
+QT_END_NAMESPACE
+
+#include "qquickplatformfoldermodel.moc"
@@ -0,0 +1,182 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Labs Platform module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QQUICKPLATFORMFOLDERMODEL_P_H
+#define QQUICKPLATFORMFOLDERMODEL_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qabstractitemmodel.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qurl.h>
+#include <QtCore/qvector.h>
+#include <QtQml/qqmlparserstatus.h>
+#include <QtQml/qqml.h>
+
+QT_BEGIN_NAMESPACE
+
+class QThread;
+class QQuickPlatformFolderScanner;
+
+struct QQuickPlatformFolderEntry
+{
+    QString name;
+    qint64 size;
+    QDateTime lastModified;
+    bool dir;
+};
+
+inline bool operator==(const QQuickPlatformFolderEntry &a, const QQuickPlatformFolderEntry &b)
+{
+    return a.dir == b.dir && a.size == b.size && a.name == b.name && a.lastModified == b.lastModified;
+}
+
+Q_DECLARE_TYPEINFO(QQuickPlatformFolderEntry, Q_MOVABLE_TYPE);
+
+typedef QVector<QQuickPlatformFolderEntry> QQuickPlatformFolderEntryList;
+
+class QQuickPlatformFolderModel : public QAbstractListModel, public QQmlParserStatus
+{
+    Q_OBJECT
+    Q_INTERFACES(QQmlParserStatus)
+    Q_PROPERTY(QUrl folder READ folder WRITE setFolder NOTIFY folderChanged FINAL)
+    Q_PROPERTY(QUrl parentFolder READ parentFolder NOTIFY folderChanged FINAL)
+    Q_PROPERTY(QStringList nameFilters READ nameFilters WRITE setNameFilters NOTIFY nameFiltersChanged FINAL)
+    Q_PROPERTY(bool showDirs READ showDirs WRITE setShowDirs NOTIFY showDirsChanged FINAL)
+    Q_PROPERTY(bool showFiles READ showFiles WRITE setShowFiles NOTIFY showFilesChanged FINAL)
+    Q_PROPERTY(bool showHidden READ showHidden WRITE setShowHidden NOTIFY showHiddenChanged FINAL)
+    Q_PROPERTY(Status status READ status NOTIFY statusChanged FINAL)
+    Q_PROPERTY(int count READ count NOTIFY countChanged FINAL)
+
+public:
+    explicit QQuickPlatformFolderModel(QObject *parent = nullptr);
+    ~QQuickPlatformFolderModel();
+
+    enum Status {
+        Null,
+        Loading,
+        Ready
+    };
+    Q_ENUM(Status)
+
+    enum Roles {
+        FileNameRole = Qt::UserRole + 1,
+        FilePathRole,
+        FileUrlRole,
+        FileSizeRole,
+        FileModifiedRole,
+        FileIsDirRole
+    };
+
+    QUrl folder() const;
+    void setFolder(const QUrl &folder);
+
+    QUrl parentFolder() const;
+
+    QStringList nameFilters() const;
+    void setNameFilters(const QStringList &filters);
+
+    bool showDirs() const;
+    void setShowDirs(bool show);
+
+    bool showFiles() const;
+    void setShowFiles(bool show);
+
+    bool showHidden() const;
+    void setShowHidden(bool show);
+
+    Status status() const;
+    int count() const;
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    Q_INVOKABLE QUrl fileUrl(int index) const;
+    Q_INVOKABLE bool isFolder(int index) const;
+
+Q_SIGNALS:
+    void folderChanged();
+    void nameFiltersChanged();
+    void showDirsChanged();
+    void showFilesChanged();
+    void showHiddenChanged();
+    void statusChanged();
+    void countChanged();
+
+protected:
+    void classBegin() override;
+    void componentComplete() override;
+
+private:
+    void refresh();
+    void setStatus(Status status);
+    QString cacheKey() const;
+
+    void entriesAdded(int generation, const QQuickPlatformFolderEntryList &entries);
+    void scanFinished(int generation, const QQuickPlatformFolderEntryList &entries, const QVector<int> &order);
+
+    bool m_complete;
+    bool m_showDirs;
+    bool m_showFiles;
+    bool m_showHidden;
+    bool m_revalidating;
+    Status m_status;
+    int m_generation;
+    QUrl m_folder;
+    QString m_path;
+    QStringList m_nameFilters;
+    QQuickPlatformFolderEntryList m_entries;
+    QThread *m_thread;
+    QQuickPlatformFolderScanner *m_scanner;
+};
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QQuickPlatformFolderEntryList)
+QML_DECLARE_TYPE(QQuickPlatformFolderModel)
+
+#endif // QQUICKPLATFORMFOLDERMODEL_P_H
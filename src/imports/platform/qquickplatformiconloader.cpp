@@ -37,15 +37,41 @@
 #include "qquickplatformiconloader_p.h"
 
 #include <QtCore/qobject.h>
+#include <QtCore/qcache.h>
 #include <QtCore/qmetaobject.h>
 #include <QtQml/qqml.h>
 
 QT_BEGIN_NAMESPACE
 
+struct QQuickPlatformIconKey
+{
+    QString themeName;
+    QString iconName;
+    QUrl iconSource;
+};
+
+static inline bool operator==(const QQuickPlatformIconKey &a, const QQuickPlatformIconKey &b)
+{
+    return a.themeName == b.themeName && a.iconName == b.iconName && a.iconSource == b.iconSource;
+}
+
+static inline uint qHash(const QQuickPlatformIconKey &key, uint seed = 0)
+{
+    return qHash(key.themeName, seed) ^ qHash(key.iconName, seed) ^ qHash(key.iconSource, seed);
+}
+
+// Menus tend to have many items with the same icon, so the icons are shared
+// between loaders instead of looking up the theme and converting the image
+// to a pixmap for each of them. The theme name is part of the key, so that
+// changing the icon theme does not return icons from the previous theme.
+typedef QCache<QQuickPlatformIconKey, QIcon> QQuickPlatformIconCache;
+Q_GLOBAL_STATIC_WITH_ARGS(QQuickPlatformIconCache, iconCache, (256))
+
 QQuickPlatformIconLoader::QQuickPlatformIconLoader(int slot, QObject *parent)
     : m_parent(parent),
       m_slot(slot),
-      m_enabled(false)
+      m_enabled(false),
+      m_iconValid(false)
 {
     Q_ASSERT(slot != -1 && parent);
 }
@@ -64,8 +90,27 @@ void QQuickPlatformIconLoader::setEnabled(bool enabled)
 
 QIcon QQuickPlatformIconLoader::icon() const
 {
-    QIcon fallback = QPixmap::fromImage(image());
-    return QIcon::fromTheme(m_iconName, fallback);
+    const QString themeName = QIcon::themeName();
+    if (m_iconValid && m_themeName == themeName)
+        return m_icon;
+
+    // the fallback is not known until the image has been loaded
+    if (isLoading()) {
+        QIcon fallback = QPixmap::fromImage(image());
+        return QIcon::fromTheme(m_iconName, fallback);
+    }
+
+    const QQuickPlatformIconKey key = { themeName, m_iconName, m_iconSource };
+    if (QIcon *cached = iconCache()->object(key)) {
+        m_icon = *cached;
+    } else {
+        QIcon fallback = QPixmap::fromImage(image());
+        m_icon = QIcon::fromTheme(m_iconName, fallback);
+        iconCache()->insert(key, new QIcon(m_icon));
+    }
+    m_themeName = themeName;
+    m_iconValid = true;
+    return m_icon;
 }
 
 QUrl QQuickPlatformIconLoader::iconSource() const
@@ -75,7 +120,11 @@ QUrl QQuickPlatformIconLoader::iconSource() const
 
 void QQuickPlatformIconLoader::setIconSource(const QUrl& source)
 {
+    if (m_iconSource == source)
+        return;
+
     m_iconSource = source;
+    m_iconValid = false;
     if (m_enabled)
         loadIcon();
 }
@@ -87,7 +136,11 @@ QString QQuickPlatformIconLoader::iconName() const
 
 void QQuickPlatformIconLoader::setIconName(const QString& name)
 {
+    if (m_iconName == name)
+        return;
+
     m_iconName = name;
+    m_iconValid = false;
     if (m_enabled)
         loadIcon();
 }
@@ -79,7 +79,9 @@ private:
     QObject *m_parent;
     int m_slot;
     bool m_enabled;
-    QIcon m_icon;
+    mutable bool m_iconValid;
+    mutable QIcon m_icon;
+    mutable QString m_themeName;
     QUrl m_iconSource;
     QString m_iconName;
 };
@@ -143,6 +143,7 @@ QQuickPlatformMenu::QQuickPlatformMenu(QObject *parent)
       m_systemTrayIcon(nullptr),
       m_menuItem(nullptr),
       m_iconLoader(nullptr),
+      m_iconKey(0),
       m_handle(nullptr)
 {
 }
@@ -216,6 +217,7 @@ void QQuickPlatformMenu::destroy()
 
     delete m_handle;
     m_handle = nullptr;
+    m_iconKey = 0;
 }
 
 void QQuickPlatformMenu::sync()
@@ -835,7 +837,12 @@ void QQuickPlatformMenu::updateIcon()
     if (!m_handle || !m_iconLoader)
         return;
 
-    m_handle->setIcon(m_iconLoader->icon());
+    const QIcon icon = m_iconLoader->icon();
+    if (icon.cacheKey() == m_iconKey)
+        return;
+
+    m_iconKey = icon.cacheKey();
+    m_handle->setIcon(icon);
     sync();
 }
 
@@ -203,6 +203,7 @@ private:
     QQuickPlatformSystemTrayIcon *m_systemTrayIcon;
     mutable QQuickPlatformMenuItem *m_menuItem;
     mutable QQuickPlatformIconLoader *m_iconLoader;
+    qint64 m_iconKey;
     QPlatformMenu *m_handle;
 };
 
@@ -110,6 +110,7 @@ QQuickPlatformMenuItem::QQuickPlatformMenuItem(QObject *parent)
       m_subMenu(nullptr),
       m_group(nullptr),
       m_iconLoader(nullptr),
+      m_iconKey(0),
       m_handle(nullptr)
 {
 }
@@ -607,7 +608,12 @@ void QQuickPlatformMenuItem::updateIcon()
     if (!m_handle || !m_iconLoader)
         return;
 
-    m_handle->setIcon(m_iconLoader->icon());
+    const QIcon icon = m_iconLoader->icon();
+    if (icon.cacheKey() == m_iconKey)
+        return;
+
+    m_iconKey = icon.cacheKey();
+    m_handle->setIcon(icon);
     sync();
 }
 
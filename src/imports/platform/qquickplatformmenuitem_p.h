@@ -178,6 +178,7 @@ private:
     QQuickPlatformMenu *m_subMenu;
     QQuickPlatformMenuItemGroup *m_group;
     mutable QQuickPlatformIconLoader *m_iconLoader;
+    qint64 m_iconKey;
     QPlatformMenuItem *m_handle;
 
     friend class QQuickPlatformMenu;
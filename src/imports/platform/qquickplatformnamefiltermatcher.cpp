@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Labs Platform module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickplatformnamefiltermatcher_p.h"
+
+#include <QtGui/qpa/qplatformdialoghelper.h>
+
+QT_BEGIN_NAMESPACE
+
+static bool isSuffixPattern(const QString &pattern)
+{
+    if (!pattern.startsWith(QLatin1String("*.")))
+        return false;
+    for (int i = 1; i < pattern.length(); ++i) {
+        const QChar c = pattern.at(i);
+        if (c == QLatin1Char('*') || c == QLatin1Char('?') || c == QLatin1Char('['))
+            return false;
+    }
+    return true;
+}
+
+static QString wildcardToRegularExpression(const QString &pattern)
+{
+    QString rx;
+    rx.reserve(pattern.length() * 2 + 2);
+    rx += QLatin1Char('^');
+    for (int i = 0; i < pattern.length(); ++i) {
+        const QChar c = pattern.at(i);
+        if (c == QLatin1Char('*')) {
+            rx += QLatin1String(".*");
+        } else if (c == QLatin1Char('?')) {
+            rx += QLatin1Char('.');
+        } else if (c == QLatin1Char('[')) {
+            const int end = pattern.indexOf(QLatin1Char(']'), i + 1);
+            if (end == -1) {
+                rx += QLatin1String("\\[");
+            } else {
+                QString set = pattern.mid(i + 1, end - i - 1);
+                if (set.startsWith(QLatin1Char('!')))
+                    set[0] = QLatin1Char('^');
+                set.replace(QLatin1Char('\\'), QLatin1String("\\\\"));
+                rx += QLatin1Char('[') + set + QLatin1Char(']');
+                i = end;
+            }
+        } else {
+            rx += QRegularExpression::escape(QString(c));
+        }
+    }
+    rx += QLatin1Char('$');
+    return rx;
+}
+
+QQuickPlatformNameFilterMatcher::QQuickPlatformNameFilterMatcher()
+    : m_matchAll(true),
+      m_caseSensitivity(Qt::CaseInsensitive)
+{
+}
+
+QQuickPlatformNameFilterMatcher::QQuickPlatformNameFilterMatcher(const QStringList &nameFilters, Qt::CaseSensitivity cs)
+    : m_matchAll(false),
+      m_caseSensitivity(cs)
+{
+    QRegularExpression::PatternOptions options = QRegularExpression::DontCaptureOption;
+    if (cs == Qt::CaseInsensitive)
+        options |= QRegularExpression::CaseInsensitiveOption;
+
+    for (const QString &nameFilter : nameFilters) {
+        const QStringList filterPatterns = patterns(nameFilter);
+        for (const QString &pattern : filterPatterns) {
+            if (pattern == QLatin1String("*") || pattern == QLatin1String("*.*")) {
+                m_matchAll = true;
+            } else if (isSuffixPattern(pattern)) {
+                const QString suffix = pattern.mid(1);
+                m_suffixes.insert(cs == Qt::CaseInsensitive ? suffix.toLower() : suffix);
+            } else {
+                QRegularExpression expression(wildcardToRegularExpression(pattern), options);
+                expression.optimize();
+                m_expressions += expression;
+            }
+        }
+    }
+
+    if (m_suffixes.isEmpty() && m_expressions.isEmpty())
+        m_matchAll = true;
+}
+
+// Returns the wildcard patterns of a name filter, for example
+// "Images (*.png *.jpg)" -> ["*.png", "*.jpg"] and "*.txt" -> ["*.txt"].
+QStringList QQuickPlatformNameFilterMatcher::patterns(const QString &nameFilter)
+{
+    return QPlatformFileDialogHelper::cleanFilterList(nameFilter);
+}
+
+bool QQuickPlatformNameFilterMatcher::matchesAll() const
+{
+    return m_matchAll;
+}
+
+bool QQuickPlatformNameFilterMatcher::matches(const QString &fileName) const
+{
+    if (m_matchAll)
+        return true;
+
+    if (!m_suffixes.isEmpty()) {
+        const QString name = m_caseSensitivity == Qt::CaseInsensitive ? fileName.toLower() : fileName;
+        for (int dot = name.indexOf(QLatin1Char('.')); dot != -1; dot = name.indexOf(QLatin1Char('.'), dot + 1)) {
+            if (m_suffixes.contains(name.mid(dot)))
+                return true;
+        }
+    }
+
+    for (const QRegularExpression &expression : m_expressions) {
+        if (expression.match(fileName).hasMatch())
+            return true;
+    }
+    return false;
+}
+
+QT_END_NAMESPACE
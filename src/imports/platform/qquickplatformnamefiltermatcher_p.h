@@ -0,0 +1,82 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Labs Platform module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QQUICKPLATFORMNAMEFILTERMATCHER_P_H
+#define QQUICKPLATFORMNAMEFILTERMATCHER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qregularexpression.h>
+#include <QtCore/qset.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+// Matches file names against a list of wildcard name filters. The filters are
+// compiled once: plain "*.ext" patterns become a set of suffixes that are looked
+// up per dot in the file name, and only the remaining patterns are turned into
+// regular expressions. Matching is const and thread-safe.
+class QQuickPlatformNameFilterMatcher
+{
+public:
+    QQuickPlatformNameFilterMatcher();
+    explicit QQuickPlatformNameFilterMatcher(const QStringList &nameFilters, Qt::CaseSensitivity cs = Qt::CaseInsensitive);
+
+    static QStringList patterns(const QString &nameFilter);
+
+    bool matchesAll() const;
+    bool matches(const QString &fileName) const;
+
+private:
+    bool m_matchAll;
+    Qt::CaseSensitivity m_caseSensitivity;
+    QSet<QString> m_suffixes;
+    QVector<QRegularExpression> m_expressions;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKPLATFORMNAMEFILTERMATCHER_P_H
@@ -171,6 +171,7 @@ QQuickPlatformSystemTrayIcon::QQuickPlatformSystemTrayIcon(QObject *parent)
       m_visible(false),
       m_menu(nullptr),
       m_iconLoader(nullptr),
+      m_iconKey(0),
       m_handle(nullptr)
 {
     m_handle = QGuiApplicationPrivate::platformTheme()->createPlatformSystemTrayIcon();
@@ -406,6 +407,7 @@ void QQuickPlatformSystemTrayIcon::cleanup()
         m_handle->cleanup();
     if (m_iconLoader)
         m_iconLoader->setEnabled(false);
+    m_iconKey = 0;
 }
 
 void QQuickPlatformSystemTrayIcon::classBegin()
@@ -435,7 +437,12 @@ void QQuickPlatformSystemTrayIcon::updateIcon()
     if (!m_handle || !m_iconLoader)
         return;
 
-    m_handle->updateIcon(m_iconLoader->icon());
+    const QIcon icon = m_iconLoader->icon();
+    if (icon.cacheKey() == m_iconKey)
+        return;
+
+    m_iconKey = icon.cacheKey();
+    m_handle->updateIcon(icon);
 }
 
 QT_END_NAMESPACE
@@ -131,6 +131,7 @@ private:
     QString m_tooltip;
     QQuickPlatformMenu *m_menu;
     mutable QQuickPlatformIconLoader *m_iconLoader;
+    qint64 m_iconKey;
     QPlatformSystemTrayIcon *m_handle;
 };
 
@@ -41,7 +41,9 @@
 #include "qquickplatformdialog_p.h"
 #include "qquickplatformcolordialog_p.h"
 #include "qquickplatformfiledialog_p.h"
+#include "qquickplatformfiledialoghelper_p.h"
 #include "qquickplatformfolderdialog_p.h"
+#include "qquickplatformfoldermodel_p.h"
 #include "qquickplatformfontdialog_p.h"
 #include "qquickplatformmessagedialog_p.h"
 
@@ -94,6 +96,7 @@ void QtLabsPlatformPlugin::registerTypes(const char *uri)
     qmlRegisterType<QQuickPlatformFileDialog>(uri, 1, 0, "FileDialog");
     qmlRegisterType<QQuickPlatformFileNameFilter>();
     qmlRegisterType<QQuickPlatformFolderDialog>(uri, 1, 0, "FolderDialog");
+    qmlRegisterType<QQuickPlatformFolderModel>(uri, 1, 0, "FolderModel");
     qmlRegisterType<QQuickPlatformFontDialog>(uri, 1, 0, "FontDialog");
     qmlRegisterType<QQuickPlatformMessageDialog>(uri, 1, 0, "MessageDialog");
 
@@ -111,6 +114,8 @@ void QtLabsPlatformPlugin::registerTypes(const char *uri)
 #if QT_CONFIG(systemtrayicon)
     qmlRegisterType<QQuickPlatformSystemTrayIcon>(uri, 1, 0, "SystemTrayIcon");
 #endif
+
+    QQuickPlatformFileDialogHelper::setImplementationUrl(QUrl(baseUrl().toString() + QStringLiteral("/FileDialogImpl.qml")));
 }
 
 QT_END_NAMESPACE
@@ -258,11 +258,16 @@ void QtQuickTemplates2Plugin::registerTypes(const char *uri)
     // QtQuick.Templates 2.3 (new types and revisions in Qt 5.10)
     qmlRegisterType<QQuickAbstractButton, 3>(uri, 2, 3, "AbstractButton");
     qmlRegisterType<QQuickAction>(uri, 2, 3, "Action");
+    qmlRegisterType<QQuickContainer, 3>(uri, 2, 3, "Container");
     qmlRegisterType<QQuickIcon>();
+    qmlRegisterType<QQuickMenu, 3>(uri, 2, 3, "Menu");
     qmlRegisterType<QQuickRangeSlider, 3>(uri, 2, 3, "RangeSlider");
     qmlRegisterType<QQuickScrollBar, 3>(uri, 2, 3, "ScrollBar");
     qmlRegisterType<QQuickScrollIndicator, 3>(uri, 2, 3, "ScrollIndicator");
     qmlRegisterType<QQuickSlider, 3>(uri, 2, 3, "Slider");
+    qmlRegisterType<QQuickSpinBox, 3>(uri, 2, 3, "SpinBox");
+    qmlRegisterType<QQuickTextArea, 3>(uri, 2, 3, "TextArea");
+    qmlRegisterType<QQuickTextField, 3>(uri, 2, 3, "TextField");
 }
 
 QT_END_NAMESPACE
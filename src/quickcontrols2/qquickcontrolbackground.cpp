@@ -0,0 +1,336 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickcontrolbackground_p.h"
+
+#include <QtQuick/qsgnode.h>
+#include <QtQuick/qsgvertexcolormaterial.h>
+#include <QtQuickTemplates2/private/qquickabstractbutton_p.h>
+#include <QtQuickTemplates2/private/qquickbutton_p.h>
+#include <QtQuickTemplates2/private/qquickcontrol_p.h>
+#include <QtQuickTemplates2/private/qquickitemdelegate_p.h>
+#include <QtQuickTemplates2/private/qquicktextarea_p.h>
+#include <QtQuickTemplates2/private/qquicktextfield_p.h>
+
+QT_BEGIN_NAMESPACE
+
+// The background is drawn with a single geometry node: a border ring made of
+// eight triangles around a fill quad. The ring and the fill have their own
+// vertices, so that both can be colored independently.
+static const int OuterVertex = 0;
+static const int InnerVertex = 4;
+static const int FillVertex = 8;
+static const int VertexCount = 12;
+static const int IndexCount = 30;
+
+static void setVertexColor(QSGGeometry::ColoredPoint2D *vertices, int first, const QColor &color)
+{
+    const qreal alpha = color.alphaF();
+    const uchar r = qRound(color.redF() * alpha * 255);
+    const uchar g = qRound(color.greenF() * alpha * 255);
+    const uchar b = qRound(color.blueF() * alpha * 255);
+    const uchar a = qRound(alpha * 255);
+    for (int i = first; i < first + 4; ++i) {
+        vertices[i].r = r;
+        vertices[i].g = g;
+        vertices[i].b = b;
+        vertices[i].a = a;
+    }
+}
+
+static void setVertexRect(QSGGeometry::ColoredPoint2D *vertices, int first, const QRectF &rect)
+{
+    const float left = rect.left();
+    const float top = rect.top();
+    const float right = rect.right();
+    const float bottom = rect.bottom();
+    vertices[first].x = left;
+    vertices[first].y = top;
+    vertices[first + 1].x = right;
+    vertices[first + 1].y = top;
+    vertices[first + 2].x = right;
+    vertices[first + 2].y = bottom;
+    vertices[first + 3].x = left;
+    vertices[first + 3].y = bottom;
+}
+
+QQuickControlBackground::QQuickControlBackground(QQuickItem *parent) :
+    QQuickItem(parent), m_dirty(GeometryDirty | ColorDirty), m_borderWidth(0),
+    m_color(Qt::transparent), m_borderColor(Qt::transparent)
+{
+    setFlag(ItemHasContents);
+}
+
+QQuickItem *QQuickControlBackground::control() const
+{
+    return m_control;
+}
+
+void QQuickControlBackground::setControl(QQuickItem *control)
+{
+    if (m_control == control)
+        return;
+
+    QQuickItem *oldControl = m_control;
+    if (oldControl)
+        disconnect(oldControl, nullptr, this, nullptr);
+
+    m_control = control;
+    if (control) {
+        connect(control, &QQuickItem::enabledChanged, this, &QQuickControlBackground::invalidate);
+        connect(control, &QQuickItem::activeFocusChanged, this, &QQuickControlBackground::invalidate);
+        if (QQuickControl *c = qobject_cast<QQuickControl *>(control)) {
+            connect(c, &QQuickControl::hoveredChanged, this, &QQuickControlBackground::invalidate);
+            connect(c, &QQuickControl::visualFocusChanged, this, &QQuickControlBackground::invalidate);
+        }
+        if (QQuickAbstractButton *button = qobject_cast<QQuickAbstractButton *>(control)) {
+            connect(button, &QQuickAbstractButton::downChanged, this, &QQuickControlBackground::invalidate);
+            connect(button, &QQuickAbstractButton::checkedChanged, this, &QQuickControlBackground::invalidate);
+        }
+        if (QQuickButton *button = qobject_cast<QQuickButton *>(control)) {
+            connect(button, &QQuickButton::highlightedChanged, this, &QQuickControlBackground::invalidate);
+            connect(button, &QQuickButton::flatChanged, this, &QQuickControlBackground::invalidate);
+        }
+        if (QQuickItemDelegate *delegate = qobject_cast<QQuickItemDelegate *>(control))
+            connect(delegate, &QQuickItemDelegate::highlightedChanged, this, &QQuickControlBackground::invalidate);
+        if (QQuickTextField *textField = qobject_cast<QQuickTextField *>(control))
+            connect(textField, &QQuickTextField::hoveredChanged, this, &QQuickControlBackground::invalidate);
+        if (QQuickTextArea *textArea = qobject_cast<QQuickTextArea *>(control))
+            connect(textArea, &QQuickTextArea::hoveredChanged, this, &QQuickControlBackground::invalidate);
+    }
+
+    controlChange(control, oldControl);
+    invalidate();
+    emit controlChanged();
+}
+
+QQuickControlBackground::States QQuickControlBackground::states() const
+{
+    States states;
+    if (!m_control)
+        return states;
+
+    if (m_control->isEnabled())
+        states |= Enabled;
+    if (m_control->hasActiveFocus())
+        states |= ActiveFocus;
+
+    if (QQuickControl *control = qobject_cast<QQuickControl *>(m_control)) {
+        if (control->isHovered())
+            states |= Hovered;
+        if (control->hasVisualFocus())
+            states |= VisualFocus;
+    }
+    if (QQuickAbstractButton *button = qobject_cast<QQuickAbstractButton *>(m_control)) {
+        if (button->isDown())
+            states |= Down;
+        if (button->isChecked())
+            states |= Checked;
+    }
+    if (QQuickButton *button = qobject_cast<QQuickButton *>(m_control)) {
+        if (button->isHighlighted())
+            states |= Highlighted;
+        if (button->isFlat())
+            states |= Flat;
+    }
+    if (QQuickItemDelegate *delegate = qobject_cast<QQuickItemDelegate *>(m_control)) {
+        if (delegate->isHighlighted())
+            states |= Highlighted;
+    }
+    if (QQuickTextField *textField = qobject_cast<QQuickTextField *>(m_control)) {
+        if (textField->isHovered())
+            states |= Hovered;
+    }
+    if (QQuickTextArea *textArea = qobject_cast<QQuickTextArea *>(m_control)) {
+        if (textArea->isHovered())
+            states |= Hovered;
+    }
+    return states;
+}
+
+QRectF QQuickControlBackground::rect() const
+{
+    return m_rect;
+}
+
+QColor QQuickControlBackground::color() const
+{
+    return m_color;
+}
+
+QColor QQuickControlBackground::borderColor() const
+{
+    return m_borderColor;
+}
+
+qreal QQuickControlBackground::borderWidth() const
+{
+    return m_borderWidth;
+}
+
+QColor QQuickControlBackground::blend(const QColor &over, const QColor &under)
+{
+    const qreal overAlpha = over.alphaF();
+    const qreal underAlpha = under.alphaF() * (1.0 - overAlpha);
+    const qreal alpha = overAlpha + underAlpha;
+    if (qFuzzyIsNull(alpha))
+        return Qt::transparent;
+
+    return QColor::fromRgbF((over.redF() * overAlpha + under.redF() * underAlpha) / alpha,
+                            (over.greenF() * overAlpha + under.greenF() * underAlpha) / alpha,
+                            (over.blueF() * overAlpha + under.blueF() * underAlpha) / alpha,
+                            alpha);
+}
+
+void QQuickControlBackground::invalidate()
+{
+    // state changes tend to come in groups (pressed, down, hovered...),
+    // so the background is evaluated once before the next frame
+    polish();
+}
+
+void QQuickControlBackground::controlChange(QQuickItem *newControl, QQuickItem *oldControl)
+{
+    Q_UNUSED(newControl);
+    Q_UNUSED(oldControl);
+}
+
+void QQuickControlBackground::setRect(const QRectF &rect)
+{
+    if (m_rect == rect)
+        return;
+
+    m_rect = rect;
+    m_dirty |= GeometryDirty;
+    update();
+}
+
+void QQuickControlBackground::setColor(const QColor &color)
+{
+    if (m_color == color)
+        return;
+
+    m_color = color;
+    m_dirty |= ColorDirty;
+    update();
+    emit colorChanged();
+}
+
+void QQuickControlBackground::setBorder(qreal width, const QColor &color)
+{
+    bool changed = false;
+    if (!qFuzzyCompare(m_borderWidth, width)) {
+        m_borderWidth = width;
+        m_dirty |= GeometryDirty;
+        changed = true;
+    }
+    if (m_borderColor != color) {
+        m_borderColor = color;
+        m_dirty |= ColorDirty;
+        changed = true;
+    }
+    if (changed) {
+        update();
+        emit borderChanged();
+    }
+}
+
+void QQuickControlBackground::updatePolish()
+{
+    QQuickItem::updatePolish();
+    updateBackground(states());
+}
+
+QSGNode *QQuickControlBackground::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *)
+{
+    QSGGeometryNode *node = static_cast<QSGGeometryNode *>(oldNode);
+    if (!node) {
+        QSGGeometry *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), VertexCount, IndexCount);
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+
+        quint16 *indices = geometry->indexDataAsUShort();
+        for (int i = 0; i < 4; ++i) {
+            const int j = (i + 1) % 4;
+            *indices++ = OuterVertex + i;
+            *indices++ = OuterVertex + j;
+            *indices++ = InnerVertex + i;
+            *indices++ = OuterVertex + j;
+            *indices++ = InnerVertex + j;
+            *indices++ = InnerVertex + i;
+        }
+        *indices++ = FillVertex;
+        *indices++ = FillVertex + 1;
+        *indices++ = FillVertex + 2;
+        *indices++ = FillVertex;
+        *indices++ = FillVertex + 2;
+        *indices++ = FillVertex + 3;
+
+        node = new QSGGeometryNode;
+        node->setGeometry(geometry);
+        node->setMaterial(new QSGVertexColorMaterial);
+        node->setFlags(QSGNode::OwnsGeometry | QSGNode::OwnsMaterial);
+        m_dirty = GeometryDirty | ColorDirty;
+    }
+
+    if (!m_dirty)
+        return node;
+
+    QSGGeometry::ColoredPoint2D *vertices = node->geometry()->vertexDataAsColoredPoint2D();
+    if (m_dirty & GeometryDirty) {
+        const qreal border = qMin(m_borderWidth, qMin(m_rect.width(), m_rect.height()) / 2);
+        const QRectF inner = m_rect.adjusted(border, border, -border, -border);
+        setVertexRect(vertices, OuterVertex, m_rect);
+        setVertexRect(vertices, InnerVertex, inner);
+        setVertexRect(vertices, FillVertex, inner);
+    }
+    if (m_dirty & ColorDirty) {
+        setVertexColor(vertices, OuterVertex, m_borderColor);
+        setVertexColor(vertices, InnerVertex, m_borderColor);
+        setVertexColor(vertices, FillVertex, m_color);
+    }
+    node->markDirty(QSGNode::DirtyGeometry);
+    m_dirty = 0;
+    return node;
+}
+
+void QQuickControlBackground::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickItem::geometryChanged(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size())
+        invalidate();
+}
+
+QT_END_NAMESPACE
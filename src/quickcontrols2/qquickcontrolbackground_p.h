@@ -0,0 +1,132 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Controls 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QQUICKCONTROLBACKGROUND_P_H
+#define QQUICKCONTROLBACKGROUND_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qpointer.h>
+#include <QtGui/qcolor.h>
+#include <QtQuick/qquickitem.h>
+#include <QtQuickControls2/private/qtquickcontrols2global_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_QUICKCONTROLS2_PRIVATE_EXPORT QQuickControlBackground : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(QQuickItem *control READ control WRITE setControl NOTIFY controlChanged FINAL)
+    Q_PROPERTY(QColor color READ color NOTIFY colorChanged FINAL)
+    Q_PROPERTY(QColor borderColor READ borderColor NOTIFY borderChanged FINAL)
+    Q_PROPERTY(qreal borderWidth READ borderWidth NOTIFY borderChanged FINAL)
+
+public:
+    explicit QQuickControlBackground(QQuickItem *parent = nullptr);
+
+    QQuickItem *control() const;
+    void setControl(QQuickItem *control);
+
+    enum State {
+        Enabled = 0x01,
+        Down = 0x02,
+        Hovered = 0x04,
+        Checked = 0x08,
+        Highlighted = 0x10,
+        Flat = 0x20,
+        ActiveFocus = 0x40,
+        VisualFocus = 0x80
+    };
+    Q_DECLARE_FLAGS(States, State)
+
+    States states() const;
+
+    QRectF rect() const;
+    QColor color() const;
+    QColor borderColor() const;
+    qreal borderWidth() const;
+
+    static QColor blend(const QColor &over, const QColor &under);
+
+Q_SIGNALS:
+    void controlChanged();
+    void colorChanged();
+    void borderChanged();
+
+protected:
+    void invalidate();
+
+    virtual void controlChange(QQuickItem *newControl, QQuickItem *oldControl);
+    virtual void updateBackground(States states) = 0;
+
+    void setRect(const QRectF &rect);
+    void setColor(const QColor &color);
+    void setBorder(qreal width, const QColor &color);
+
+    void updatePolish() override;
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+
+private:
+    enum DirtyFlag {
+        GeometryDirty = 0x1,
+        ColorDirty = 0x2
+    };
+
+    int m_dirty;
+    qreal m_borderWidth;
+    QRectF m_rect;
+    QColor m_color;
+    QColor m_borderColor;
+    QPointer<QQuickItem> m_control;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(QQuickControlBackground::States)
+
+QT_END_NAMESPACE
+
+QML_DECLARE_TYPE(QQuickControlBackground)
+
+#endif // QQUICKCONTROLBACKGROUND_P_H
@@ -36,6 +36,7 @@
 
 #include "qquickpaddedrectangle_p.h"
 
+#include <QtQuick/private/qquickrectangle_p_p.h>
 #include <QtQuick/private/qsgadaptationlayer_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -43,8 +44,12 @@ QT_BEGIN_NAMESPACE
 QQuickPaddedRectangle::QQuickPaddedRectangle(QQuickItem *parent) :
     QQuickRectangle(parent), m_padding(0),
     m_topPadding(0), m_leftPadding(0), m_rightPadding(0), m_bottomPadding(0),
-    m_hasTopPadding(false), m_hasLeftPadding(false), m_hasRightPadding(false), m_hasBottomPadding(false)
+    m_hasTopPadding(false), m_hasLeftPadding(false), m_hasRightPadding(false), m_hasBottomPadding(false),
+    m_dirty(AllDirty), m_borderWidth(0), m_borderAligned(false)
 {
+    connect(this, &QQuickRectangle::colorChanged, this, &QQuickPaddedRectangle::invalidateStyle);
+    connect(this, &QQuickRectangle::radiusChanged, this, &QQuickPaddedRectangle::invalidateStyle);
+    connect(this, &QQuickItem::antialiasingChanged, this, &QQuickPaddedRectangle::invalidateStyle);
 }
 
 qreal QQuickPaddedRectangle::padding() const
@@ -54,19 +59,13 @@ qreal QQuickPaddedRectangle::padding() const
 
 void QQuickPaddedRectangle::setPadding(qreal padding)
 {
-    if (!qFuzzyCompare(m_padding, padding)) {
-        m_padding = padding;
-        update();
-        emit paddingChanged();
-        if (m_hasTopPadding)
-            emit topPaddingChanged();
-        if (!m_hasLeftPadding)
-            emit leftPaddingChanged();
-        if (!m_hasRightPadding)
-            emit rightPaddingChanged();
-        if (!m_hasBottomPadding)
-            emit bottomPaddingChanged();
-    }
+    if (qFuzzyCompare(m_padding, padding))
+        return;
+
+    const QMarginsF oldPadding = paddings();
+    m_padding = padding;
+    emit paddingChanged();
+    paddingChange(oldPadding);
 }
 
 void QQuickPaddedRectangle::resetPadding()
@@ -136,75 +135,117 @@ void QQuickPaddedRectangle::resetBottomPadding()
 
 void QQuickPaddedRectangle::setTopPadding(qreal padding, bool has)
 {
-    qreal oldPadding = topPadding();
+    const QMarginsF oldPadding = paddings();
     m_hasTopPadding = has;
     m_topPadding = padding;
-    if (!qFuzzyCompare(oldPadding, padding)) {
-        update();
-        emit topPaddingChanged();
-    }
+    paddingChange(oldPadding);
 }
 
 void QQuickPaddedRectangle::setLeftPadding(qreal padding, bool has)
 {
-    qreal oldPadding = leftPadding();
+    const QMarginsF oldPadding = paddings();
     m_hasLeftPadding = has;
     m_leftPadding = padding;
-    if (!qFuzzyCompare(oldPadding, padding)) {
-        update();
-        emit leftPaddingChanged();
-    }
+    paddingChange(oldPadding);
 }
 
 void QQuickPaddedRectangle::setRightPadding(qreal padding, bool has)
 {
-    qreal oldPadding = rightPadding();
+    const QMarginsF oldPadding = paddings();
     m_hasRightPadding = has;
     m_rightPadding = padding;
-    if (!qFuzzyCompare(oldPadding, padding)) {
-        update();
-        emit rightPaddingChanged();
-    }
+    paddingChange(oldPadding);
 }
 
 void QQuickPaddedRectangle::setBottomPadding(qreal padding, bool has)
 {
-    qreal oldPadding = bottomPadding();
+    const QMarginsF oldPadding = paddings();
     m_hasBottomPadding = has;
     m_bottomPadding = padding;
-    if (!qFuzzyCompare(oldPadding, padding)) {
-        update();
+    paddingChange(oldPadding);
+}
+
+QMarginsF QQuickPaddedRectangle::paddings() const
+{
+    return QMarginsF(leftPadding(), topPadding(), rightPadding(), bottomPadding());
+}
+
+void QQuickPaddedRectangle::paddingChange(const QMarginsF &oldPadding)
+{
+    // compare the effective values, so that only the sides that actually
+    // moved are notified and repainted
+    const QMarginsF newPadding = paddings();
+    if (newPadding == oldPadding)
+        return;
+
+    m_dirty |= PaddingDirty;
+    update();
+
+    if (!qFuzzyCompare(newPadding.top(), oldPadding.top()))
+        emit topPaddingChanged();
+    if (!qFuzzyCompare(newPadding.left(), oldPadding.left()))
+        emit leftPaddingChanged();
+    if (!qFuzzyCompare(newPadding.right(), oldPadding.right()))
+        emit rightPaddingChanged();
+    if (!qFuzzyCompare(newPadding.bottom(), oldPadding.bottom()))
         emit bottomPaddingChanged();
-    }
 }
 
-QSGNode *QQuickPaddedRectangle::updatePaintNode(QSGNode *node, UpdatePaintNodeData *data)
+void QQuickPaddedRectangle::invalidateStyle()
 {
-    QSGTransformNode *transformNode = static_cast<QSGTransformNode *>(node);
-    if (!transformNode)
-        transformNode = new QSGTransformNode;
+    m_dirty |= StyleDirty;
+}
+
+bool QQuickPaddedRectangle::isStyleDirty() const
+{
+    if (m_dirty & StyleDirty)
+        return true;
+
+    // QQuickRectangle does not notify about gradient or border changes, and
+    // the border is created lazily, so compare the border to the last state
+    // that was passed to the node
+    QQuickRectanglePrivate *d = static_cast<QQuickRectanglePrivate *>(QQuickItemPrivate::get(const_cast<QQuickPaddedRectangle *>(this)));
+    if (d->gradient)
+        return true;
 
-    QSGInternalRectangleNode *rectNode = static_cast<QSGInternalRectangleNode *>(QQuickRectangle::updatePaintNode(transformNode->firstChild(), data));
+    const QQuickPen *pen = d->pen;
+    if (!pen || !pen->isValid())
+        return m_borderWidth != 0;
+    return m_borderWidth != pen->width() || m_borderColor != pen->color() || m_borderAligned != pen->pixelAligned();
+}
 
-    if (rectNode) {
-        if (!transformNode->firstChild())
-            transformNode->appendChildNode(rectNode);
+QSGNode *QQuickPaddedRectangle::updatePaintNode(QSGNode *node, UpdatePaintNodeData *data)
+{
+    QSGInternalRectangleNode *rectNode = static_cast<QSGInternalRectangleNode *>(node);
 
-        qreal top = topPadding();
-        qreal left = leftPadding();
-        qreal right = rightPadding();
-        qreal bottom = bottomPadding();
+    // When only the geometry or the padding has changed, there is no need to
+    // let QQuickRectangle set up the node all over again just to override its
+    // rect below. The rect is applied in place to the existing node instead.
+    if (!rectNode || width() <= 0 || height() <= 0 || isStyleDirty()) {
+        rectNode = static_cast<QSGInternalRectangleNode *>(QQuickRectangle::updatePaintNode(rectNode, data));
 
-        if (!qFuzzyIsNull(top) || !qFuzzyIsNull(left) || !qFuzzyIsNull(right) || !qFuzzyIsNull(bottom)) {
-            QMatrix4x4 m;
-            m.translate(left, top);
-            transformNode->setMatrix(m);
+        const QQuickPen *pen = static_cast<QQuickRectanglePrivate *>(QQuickItemPrivate::get(this))->pen;
+        const bool hasBorder = pen && pen->isValid();
+        m_borderWidth = hasBorder ? pen->width() : 0;
+        m_borderColor = hasBorder ? pen->color() : QColor();
+        m_borderAligned = hasBorder && pen->pixelAligned();
+        m_dirty |= GeometryDirty;
+    }
 
-            rectNode->setRect(boundingRect().adjusted(0, 0, -left-right, -top-bottom));
-            rectNode->update();
-        }
+    if (rectNode && (m_dirty & (PaddingDirty | GeometryDirty))) {
+        rectNode->setRect(boundingRect().marginsRemoved(paddings()));
+        rectNode->update();
     }
-    return transformNode;
+
+    m_dirty = rectNode ? 0 : AllDirty;
+    return rectNode;
+}
+
+void QQuickPaddedRectangle::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+    QQuickRectangle::geometryChanged(newGeometry, oldGeometry);
+    if (newGeometry.size() != oldGeometry.size())
+        m_dirty |= GeometryDirty;
 }
 
 QT_END_NAMESPACE
@@ -48,6 +48,7 @@
 // We mean it.
 //
 
+#include <QtCore/qmargins.h>
 #include <QtQuick/private/qquickrectangle_p.h>
 #include <QtQuickControls2/private/qtquickcontrols2global_p.h>
 
@@ -94,8 +95,22 @@ Q_SIGNALS:
 
 protected:
     QSGNode *updatePaintNode(QSGNode *, UpdatePaintNodeData *) override;
+    void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
 
 private:
+    enum DirtyFlag {
+        PaddingDirty = 0x1,
+        GeometryDirty = 0x2,
+        StyleDirty = 0x4,
+        AllDirty = PaddingDirty | GeometryDirty | StyleDirty
+    };
+
+    QMarginsF paddings() const;
+    void paddingChange(const QMarginsF &oldPadding);
+
+    void invalidateStyle();
+    bool isStyleDirty() const;
+
     void setTopPadding(qreal padding, bool has);
     void setLeftPadding(qreal padding, bool has);
     void setRightPadding(qreal padding, bool has);
@@ -110,6 +125,11 @@ private:
     bool m_hasLeftPadding;
     bool m_hasRightPadding;
     bool m_hasBottomPadding;
+    int m_dirty;
+    // the border last passed to the node
+    qreal m_borderWidth;
+    QColor m_borderColor;
+    bool m_borderAligned;
 };
 
 QT_END_NAMESPACE
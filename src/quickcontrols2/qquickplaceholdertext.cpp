@@ -49,7 +49,10 @@ QQuickPlaceholderText::QQuickPlaceholderText(QQuickItem *parent) : QQuickText(pa
 void QQuickPlaceholderText::componentComplete()
 {
     QQuickText::componentComplete();
-    connect(parentItem(), SIGNAL(effectiveHorizontalAlignmentChanged()), this, SLOT(updateAlignment()));
+    if (QQuickTextInput *input = qobject_cast<QQuickTextInput *>(parentItem()))
+        connect(input, &QQuickTextInput::effectiveHorizontalAlignmentChanged, this, &QQuickPlaceholderText::updateAlignment);
+    else if (QQuickTextEdit *edit = qobject_cast<QQuickTextEdit *>(parentItem()))
+        connect(edit, &QQuickTextEdit::effectiveHorizontalAlignmentChanged, this, &QQuickPlaceholderText::updateAlignment);
     updateAlignment();
 }
 
@@ -3,6 +3,7 @@ HEADERS += \
     $$PWD/qquickattachedobject_p.h \
     $$PWD/qquickcolor_p.h \
     $$PWD/qquickcolorimageprovider_p.h \
+    $$PWD/qquickcontrolbackground_p.h \
     $$PWD/qquickiconimage_p.h \
     $$PWD/qquickiconimage_p_p.h \
     $$PWD/qquickiconlabel_p.h \
@@ -21,6 +22,7 @@ SOURCES += \
     $$PWD/qquickattachedobject.cpp \
     $$PWD/qquickcolor.cpp \
     $$PWD/qquickcolorimageprovider.cpp \
+    $$PWD/qquickcontrolbackground.cpp \
     $$PWD/qquickiconimage.cpp \
     $$PWD/qquickiconlabel.cpp \
     $$PWD/qquickplaceholdertext.cpp \
@@ -156,9 +156,6 @@ QQuickAbstractButtonPrivate::QQuickAbstractButtonPrivate()
       autoRepeat(false),
       wasHeld(false),
       touchId(-1),
-      holdTimer(0),
-      delayTimer(0),
-      repeatTimer(0),
       repeatButton(Qt::NoButton),
       indicator(nullptr),
       group(nullptr),
@@ -193,7 +190,7 @@ void QQuickAbstractButtonPrivate::handleMove(const QPointF &point)
 
     if (!pressed && autoRepeat)
         stopPressRepeat();
-    else if (holdTimer > 0 && (!pressed || QLineF(pressPoint, point).length() > QGuiApplication::styleHints()->startDragDistance()))
+    else if (holdTimer.isActive() && (!pressed || QLineF(pressPoint, point).length() > QGuiApplication::styleHints()->startDragDistance()))
         stopPressAndHold();
 }
 
@@ -246,43 +243,32 @@ void QQuickAbstractButtonPrivate::startPressAndHold()
     wasHeld = false;
     stopPressAndHold();
     if (isPressAndHoldConnected())
-        holdTimer = q->startTimer(QGuiApplication::styleHints()->mousePressAndHoldInterval());
+        holdTimer.start(QGuiApplication::styleHints()->mousePressAndHoldInterval(), q);
 }
 
 void QQuickAbstractButtonPrivate::stopPressAndHold()
 {
-    Q_Q(QQuickAbstractButton);
-    if (holdTimer > 0) {
-        q->killTimer(holdTimer);
-        holdTimer = 0;
-    }
+    holdTimer.stop();
 }
 
 void QQuickAbstractButtonPrivate::startRepeatDelay()
 {
     Q_Q(QQuickAbstractButton);
     stopPressRepeat();
-    delayTimer = q->startTimer(AUTO_REPEAT_DELAY);
+    delayTimer.start(AUTO_REPEAT_DELAY, q);
 }
 
 void QQuickAbstractButtonPrivate::startPressRepeat()
 {
     Q_Q(QQuickAbstractButton);
     stopPressRepeat();
-    repeatTimer = q->startTimer(AUTO_REPEAT_INTERVAL);
+    repeatTimer.start(AUTO_REPEAT_INTERVAL, q);
 }
 
 void QQuickAbstractButtonPrivate::stopPressRepeat()
 {
-    Q_Q(QQuickAbstractButton);
-    if (delayTimer > 0) {
-        q->killTimer(delayTimer);
-        delayTimer = 0;
-    }
-    if (repeatTimer > 0) {
-        q->killTimer(repeatTimer);
-        repeatTimer = 0;
-    }
+    delayTimer.stop();
+    repeatTimer.stop();
 }
 
 void QQuickAbstractButtonPrivate::click()
@@ -855,13 +841,13 @@ void QQuickAbstractButton::timerEvent(QTimerEvent *event)
 {
     Q_D(QQuickAbstractButton);
     QQuickControl::timerEvent(event);
-    if (event->timerId() == d->holdTimer) {
+    if (event->timerId() == d->holdTimer.timerId()) {
         d->stopPressAndHold();
         d->wasHeld = true;
         emit pressAndHold();
-    } else if (event->timerId() == d->delayTimer) {
+    } else if (event->timerId() == d->delayTimer.timerId()) {
         d->startPressRepeat();
-    } else if (event->timerId() == d->repeatTimer) {
+    } else if (event->timerId() == d->repeatTimer.timerId()) {
         emit released();
         d->trigger();
         emit pressed();
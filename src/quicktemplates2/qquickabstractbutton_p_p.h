@@ -50,6 +50,7 @@
 
 #include <QtQuickTemplates2/private/qquickabstractbutton_p.h>
 #include <QtQuickTemplates2/private/qquickcontrol_p_p.h>
+#include <QtQuickTemplates2/private/qquicktimerwheel_p_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -100,9 +101,9 @@ public:
     bool autoRepeat;
     bool wasHeld;
     int touchId;
-    int holdTimer;
-    int delayTimer;
-    int repeatTimer;
+    QQuickWheelTimer holdTimer;
+    QQuickWheelTimer delayTimer;
+    QQuickWheelTimer repeatTimer;
     QPointF pressPoint;
     Qt::MouseButton repeatButton;
     QQuickItem *indicator;
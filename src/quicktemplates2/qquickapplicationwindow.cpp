@@ -139,6 +139,7 @@ class QQuickApplicationWindowPrivate : public QQuickItemChangeListener
 public:
     QQuickApplicationWindowPrivate()
         : complete(false),
+          relayouting(false),
           background(nullptr),
           contentItem(nullptr),
           header(nullptr),
@@ -154,6 +155,7 @@ public:
     }
 
     void relayout();
+    void scheduleRelayout();
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff) override;
     void itemVisibilityChanged(QQuickItem *item) override;
@@ -172,6 +174,7 @@ public:
     void setActiveFocusControl(QQuickItem *item);
 
     bool complete;
+    bool relayouting;
     QQuickItem *background;
     QQuickItem *contentItem;
     QQuickItem *header;
@@ -183,22 +186,48 @@ public:
     QQuickApplicationWindow *q_ptr;
 };
 
+// Lays out the content item, and the header, footer and background on the
+// polish pass of the content item, so that several changes within a frame
+// (for example resize events of an interactive window resize) result in a
+// single relayout.
+class QQuickApplicationWindowContentItem : public QQuickItem
+{
+public:
+    QQuickApplicationWindowContentItem(QQuickApplicationWindowPrivate *window, QQuickItem *parent)
+        : QQuickItem(parent), window(window)
+    {
+    }
+
+protected:
+    void updatePolish() override
+    {
+        window->relayout();
+    }
+
+private:
+    QQuickApplicationWindowPrivate *window;
+};
+
 void QQuickApplicationWindowPrivate::relayout()
 {
     Q_Q(QQuickApplicationWindow);
     QQuickItem *content = q->contentItem();
+    const qreal w = q->width();
+    const qreal h = q->height();
     qreal hh = header && header->isVisible() ? header->height() : 0;
     qreal fh = footer && footer->isVisible() ? footer->height() : 0;
 
+    relayouting = true;
+
     content->setY(hh);
-    content->setWidth(q->width());
-    content->setHeight(q->height() - hh - fh);
+    content->setWidth(w);
+    content->setHeight(h - hh - fh);
 
     if (header) {
         header->setY(-hh);
         QQuickItemPrivate *p = QQuickItemPrivate::get(header);
-        if (!p->widthValid) {
-            header->setWidth(q->width());
+        if (!p->widthValid && header->width() != w) {
+            header->setWidth(w);
             p->widthValid = false;
         }
     }
@@ -206,49 +235,60 @@ void QQuickApplicationWindowPrivate::relayout()
     if (footer) {
         footer->setY(content->height());
         QQuickItemPrivate *p = QQuickItemPrivate::get(footer);
-        if (!p->widthValid) {
-            footer->setWidth(q->width());
+        if (!p->widthValid && footer->width() != w) {
+            footer->setWidth(w);
             p->widthValid = false;
         }
     }
 
     if (background) {
         QQuickItemPrivate *p = QQuickItemPrivate::get(background);
-        if (!p->widthValid && qFuzzyIsNull(background->x())) {
-            background->setWidth(q->width());
+        if (!p->widthValid && qFuzzyIsNull(background->x()) && background->width() != w) {
+            background->setWidth(w);
             p->widthValid = false;
         }
-        if (!p->heightValid && qFuzzyIsNull(background->y())) {
-            background->setHeight(q->height());
+        if (!p->heightValid && qFuzzyIsNull(background->y()) && background->height() != h) {
+            background->setHeight(h);
             p->heightValid = false;
         }
     }
+
+    relayouting = false;
+}
+
+void QQuickApplicationWindowPrivate::scheduleRelayout()
+{
+    Q_Q(QQuickApplicationWindow);
+    q->contentItem()->polish();
 }
 
 void QQuickApplicationWindowPrivate::itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff)
 {
     Q_UNUSED(item)
-    Q_UNUSED(change)
     Q_UNUSED(diff)
-    relayout();
+    // relayout() moves the header and footer, and resizes them horizontally,
+    // which does not affect the layout unless their height changes as a result
+    if (relayouting && !change.heightChange())
+        return;
+    scheduleRelayout();
 }
 
 void QQuickApplicationWindowPrivate::itemVisibilityChanged(QQuickItem *item)
 {
     Q_UNUSED(item);
-    relayout();
+    scheduleRelayout();
 }
 
 void QQuickApplicationWindowPrivate::itemImplicitWidthChanged(QQuickItem *item)
 {
     Q_UNUSED(item);
-    relayout();
+    scheduleRelayout();
 }
 
 void QQuickApplicationWindowPrivate::itemImplicitHeightChanged(QQuickItem *item)
 {
     Q_UNUSED(item);
-    relayout();
+    scheduleRelayout();
 }
 
 void QQuickApplicationWindowPrivate::updateFont(const QFont &f)
@@ -524,7 +564,7 @@ QQuickItem *QQuickApplicationWindow::contentItem() const
 {
     QQuickApplicationWindowPrivate *d = const_cast<QQuickApplicationWindowPrivate *>(d_func());
     if (!d->contentItem) {
-        d->contentItem = new QQuickItem(QQuickWindow::contentItem());
+        d->contentItem = new QQuickApplicationWindowContentItem(d, QQuickWindow::contentItem());
         d->contentItem->setFlag(QQuickItem::ItemIsFocusScope);
         d->contentItem->setFocus(true);
         d->relayout();
@@ -709,7 +749,17 @@ void QQuickApplicationWindow::resizeEvent(QResizeEvent *event)
 {
     Q_D(QQuickApplicationWindow);
     QQuickWindowQmlImpl::resizeEvent(event);
-    d->relayout();
+    d->scheduleRelayout();
+}
+
+bool QQuickApplicationWindow::event(QEvent *event)
+{
+    Q_D(QQuickApplicationWindow);
+    if (event->type() == QEvent::ThemeChange || event->type() == QEvent::ApplicationFontChange) {
+        QQuickControlPrivate::invalidateThemeFonts();
+        d->resolveFont();
+    }
+    return QQuickWindowQmlImpl::event(event);
 }
 
 class QQuickApplicationWindowAttachedPrivate : public QObjectPrivate
@@ -117,6 +117,7 @@ protected:
     void classBegin() override;
     void componentComplete() override;
     void resizeEvent(QResizeEvent *event) override;
+    bool event(QEvent *event) override;
 
 private:
     Q_DISABLE_COPY(QQuickApplicationWindow)
@@ -148,7 +148,12 @@ QQuickContainerPrivate::QQuickContainerPrivate()
     : contentModel(nullptr),
       currentIndex(-1),
       updatingCurrent(false),
-      changeTypes(Destroyed | Parent | SiblingOrder)
+      changeTypes(Destroyed | Parent | SiblingOrder),
+      batchDepth(0),
+      batchCount(0),
+      contentChildrenChangePending(false),
+      batchCurrentIndex(-1),
+      batchCurrentItem(nullptr)
 {
 }
 
@@ -156,8 +161,8 @@ void QQuickContainerPrivate::init()
 {
     Q_Q(QQuickContainer);
     contentModel = new QQmlObjectModel(q);
-    QObject::connect(contentModel, &QQmlObjectModel::countChanged, q, &QQuickContainer::countChanged);
-    QObject::connect(contentModel, &QQmlObjectModel::childrenChanged, q, &QQuickContainer::contentChildrenChanged);
+    connect(contentModel, &QQmlObjectModel::countChanged, this, &QQuickContainerPrivate::notifyCountChanged);
+    connect(contentModel, &QQmlObjectModel::childrenChanged, this, &QQuickContainerPrivate::notifyContentChildrenChanged);
 }
 
 void QQuickContainerPrivate::cleanup()
@@ -180,8 +185,8 @@ void QQuickContainerPrivate::cleanup()
         delete contentItem;
     }
 
-    QObject::disconnect(contentModel, &QQmlObjectModel::countChanged, q, &QQuickContainer::countChanged);
-    QObject::disconnect(contentModel, &QQmlObjectModel::childrenChanged, q, &QQuickContainer::contentChildrenChanged);
+    disconnect(contentModel, &QQmlObjectModel::countChanged, this, &QQuickContainerPrivate::notifyCountChanged);
+    disconnect(contentModel, &QQmlObjectModel::childrenChanged, this, &QQuickContainerPrivate::notifyContentChildrenChanged);
     delete contentModel;
 }
 
@@ -258,6 +263,127 @@ void QQuickContainerPrivate::removeItem(int index, QQuickItem *item)
     updatingCurrent = false;
 }
 
+// Bulk operations are wrapped in a batch, so that count, contentChildren
+// and the current index/item are notified once per operation rather than
+// once per item. Subclasses still get itemAdded()/itemRemoved() per item.
+void QQuickContainerPrivate::beginBatch()
+{
+    if (batchDepth++ > 0)
+        return;
+
+    batchCount = contentModel->count();
+    contentChildrenChangePending = false;
+    batchCurrentIndex = currentIndex;
+    batchCurrentItem = itemAt(currentIndex);
+    updatingCurrent = true;
+}
+
+void QQuickContainerPrivate::endBatch()
+{
+    Q_Q(QQuickContainer);
+    Q_ASSERT(batchDepth > 0);
+    if (--batchDepth > 0)
+        return;
+
+    updatingCurrent = false;
+
+    if (contentModel->count() != batchCount)
+        emit q->countChanged();
+    if (contentChildrenChangePending) {
+        contentChildrenChangePending = false;
+        emit q->contentChildrenChanged();
+    }
+    if (currentIndex != batchCurrentIndex)
+        emit q->currentIndexChanged();
+    if (currentIndex != batchCurrentIndex || itemAt(currentIndex) != batchCurrentItem)
+        emit q->currentItemChanged();
+    batchCurrentItem = nullptr;
+}
+
+int QQuickContainerPrivate::insertItems(int index, const QList<QObject *> &items)
+{
+    Q_Q(QQuickContainer);
+    const int oldCount = contentModel->count();
+    int at = index;
+    for (QObject *object : items) {
+        QQuickItem *item = qobject_cast<QQuickItem *>(object);
+        if (!item || !q->isContent(item) || contentModel->indexOf(item, nullptr) != -1)
+            continue;
+
+        contentData.append(item);
+        item->setParentItem(effectiveContentItem(contentItem));
+        QQuickItemPrivate::get(item)->addItemChangeListener(this, changeTypes);
+        contentModel->insert(at, item);
+        q->itemAdded(at, item);
+        ++at;
+    }
+
+    const int inserted = at - index;
+    if (inserted > 0) {
+        if (oldCount == 0 && currentIndex == -1)
+            currentIndex = 0;
+        else if (currentIndex >= index)
+            currentIndex += inserted;
+    }
+    return inserted;
+}
+
+void QQuickContainerPrivate::removeItems(int index, int count)
+{
+    Q_Q(QQuickContainer);
+    QVector<QQuickItem *> removed;
+    removed.reserve(count);
+    for (int i = index; i < index + count; ++i) {
+        QQuickItem *item = itemAt(i);
+        removed += item;
+        if (!item)
+            continue;
+        contentData.removeOne(item);
+        QQuickItemPrivate::get(item)->removeItemChangeListener(this, changeTypes);
+        item->setParentItem(nullptr);
+    }
+
+    if (currentIndex >= index + count)
+        currentIndex -= count;
+    else if (currentIndex >= index)
+        currentIndex = index - 1;
+
+    contentModel->remove(index, count);
+
+    for (int i = count - 1; i >= 0; --i) {
+        if (QQuickItem *item = removed.at(i))
+            q->itemRemoved(index + i, item);
+    }
+}
+
+void QQuickContainerPrivate::moveItems(int from, int to, int count)
+{
+    contentModel->move(from, to, count);
+
+    if (currentIndex >= from && currentIndex < from + count)
+        currentIndex += to - from;
+    else if (from < to && currentIndex >= from + count && currentIndex < to + count)
+        currentIndex -= count;
+    else if (from > to && currentIndex >= to && currentIndex < from)
+        currentIndex += count;
+}
+
+void QQuickContainerPrivate::notifyCountChanged()
+{
+    Q_Q(QQuickContainer);
+    if (batchDepth == 0)
+        emit q->countChanged();
+}
+
+void QQuickContainerPrivate::notifyContentChildrenChanged()
+{
+    Q_Q(QQuickContainer);
+    if (batchDepth > 0)
+        contentChildrenChangePending = true;
+    else
+        emit q->contentChildrenChanged();
+}
+
 void QQuickContainerPrivate::_q_currentIndexChanged()
 {
     Q_Q(QQuickContainer);
@@ -471,6 +597,111 @@ void QQuickContainer::removeItem(int index)
         d->removeItem(index, item);
 }
 
+/*!
+    \qmlmethod void QtQuick.Controls::Container::insertItems(int index, list<Item> items)
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+
+    Inserts \a items at \a index. If \a index is out of range, the items are
+    appended. Items that are already in the container are ignored.
+
+    Unlike repeated calls to \l insertItem(), the \l count, \l contentChildren,
+    \l currentIndex and \l currentItem properties are notified only once.
+
+    \sa insertItem(), removeItems(), replaceItems()
+*/
+void QQuickContainer::insertItems(int index, const QList<QObject *> &items)
+{
+    Q_D(QQuickContainer);
+    const int count = d->contentModel->count();
+    if (index < 0 || index > count)
+        index = count;
+
+    d->beginBatch();
+    d->insertItems(index, items);
+    d->endBatch();
+}
+
+/*!
+    \qmlmethod void QtQuick.Controls::Container::removeItems(int index, int count)
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+
+    Removes \a count items starting at \a index.
+
+    Unlike repeated calls to \l removeItem(), the \l count, \l contentChildren,
+    \l currentIndex and \l currentItem properties are notified only once.
+
+    \note The ownership of the items is transferred to the caller.
+
+    \sa removeItem(), insertItems()
+*/
+void QQuickContainer::removeItems(int index, int count)
+{
+    Q_D(QQuickContainer);
+    const int total = d->contentModel->count();
+    if (index < 0 || index >= total || count <= 0)
+        return;
+    count = qMin(count, total - index);
+
+    d->beginBatch();
+    d->removeItems(index, count);
+    d->endBatch();
+}
+
+/*!
+    \qmlmethod void QtQuick.Controls::Container::moveItems(int from, int to, int count)
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+
+    Moves \a count items starting at index \a from, so that the first of them
+    ends up at index \a to.
+
+    \sa moveItem()
+*/
+void QQuickContainer::moveItems(int from, int to, int count)
+{
+    Q_D(QQuickContainer);
+    const int total = d->contentModel->count();
+    if (from < 0 || from >= total || count <= 0)
+        return;
+    count = qMin(count, total - from);
+    to = qBound(0, to, total - count);
+    if (from == to)
+        return;
+
+    d->beginBatch();
+    d->moveItems(from, to, count);
+    d->endBatch();
+}
+
+/*!
+    \qmlmethod void QtQuick.Controls::Container::replaceItems(list<Item> items)
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+
+    Replaces all items in the container with \a items. If the current item is
+    also present in \a items, it remains current.
+
+    \note The ownership of the removed items is transferred to the caller.
+
+    \sa insertItems(), removeItems()
+*/
+void QQuickContainer::replaceItems(const QList<QObject *> &items)
+{
+    Q_D(QQuickContainer);
+    d->beginBatch();
+
+    QQuickItem *oldCurrentItem = d->itemAt(d->currentIndex);
+    const int count = d->contentModel->count();
+    if (count > 0)
+        d->removeItems(0, count);
+    d->currentIndex = -1;
+    d->insertItems(0, items);
+
+    const int index = oldCurrentItem ? d->contentModel->indexOf(oldCurrentItem, nullptr) : -1;
+    if (index != -1)
+        d->currentIndex = index;
+
+    d->endBatch();
+}
+
 /*!
     \qmlproperty model QtQuick.Controls::Container::contentModel
     \readonly
@@ -77,6 +77,11 @@ public:
     Q_INVOKABLE void moveItem(int from, int to);
     Q_INVOKABLE void removeItem(int index);
 
+    Q_REVISION(3) Q_INVOKABLE void insertItems(int index, const QList<QObject *> &items);
+    Q_REVISION(3) Q_INVOKABLE void removeItems(int index, int count);
+    Q_REVISION(3) Q_INVOKABLE void moveItems(int from, int to, int count);
+    Q_REVISION(3) Q_INVOKABLE void replaceItems(const QList<QObject *> &items);
+
     QVariant contentModel() const;
     QQmlListProperty<QObject> contentData();
     QQmlListProperty<QQuickItem> contentChildren();
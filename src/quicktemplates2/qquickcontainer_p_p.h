@@ -69,6 +69,15 @@ public:
     void moveItem(int from, int to);
     void removeItem(int index, QQuickItem *item);
 
+    void beginBatch();
+    void endBatch();
+    int insertItems(int index, const QList<QObject *> &items);
+    void removeItems(int index, int count);
+    void moveItems(int from, int to, int count);
+
+    void notifyCountChanged();
+    void notifyContentChildrenChanged();
+
     void _q_currentIndexChanged();
 
     void itemChildAdded(QQuickItem *item, QQuickItem *child) override;
@@ -91,6 +100,12 @@ public:
     int currentIndex;
     bool updatingCurrent;
     QQuickItemPrivate::ChangeTypes changeTypes;
+
+    int batchDepth;
+    int batchCount;
+    bool contentChildrenChangePending;
+    int batchCurrentIndex;
+    QQuickItem *batchCurrentItem;
 };
 
 QT_END_NAMESPACE
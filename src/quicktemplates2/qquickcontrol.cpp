@@ -37,6 +37,7 @@
 #include "qquickcontrol_p.h"
 #include "qquickcontrol_p_p.h"
 
+#include <QtCore/qbitarray.h>
 #include <QtGui/qstylehints.h>
 #include <QtGui/qguiapplication.h>
 #include "qquicklabel_p.h"
@@ -120,14 +121,14 @@ QQuickControlPrivate::QQuickControlPrivate()
       hovered(false),
       explicitHoverEnabled(false),
 #endif
+      focusPolicy(Qt::NoFocus),
+      focusReason(Qt::OtherFocusReason),
       padding(0),
       topPadding(0),
       leftPadding(0),
       rightPadding(0),
       bottomPadding(0),
       spacing(0),
-      focusPolicy(Qt::NoFocus),
-      focusReason(Qt::OtherFocusReason),
       background(nullptr),
       contentItem(nullptr),
       accessibleAttached(nullptr)
@@ -279,18 +280,64 @@ QFont QQuickControlPrivate::parentFont(const QQuickItem *item)
     return themeFont(QPlatformTheme::SystemFont);
 }
 
+// Every control looks up a theme font when it resolves its font, so the
+// fonts of the platform theme are looked up once and shared. The snapshot
+// is discarded when the platform theme or the font database changes, and
+// by QQuickApplicationWindow on ThemeChange and ApplicationFontChange.
+struct QQuickThemeFonts
+{
+    QQuickThemeFonts()
+        : theme(nullptr),
+          resolved(QPlatformTheme::NFonts),
+          available(QPlatformTheme::NFonts)
+    {
+    }
+
+    QPlatformTheme *theme;
+    QMetaObject::Connection fontDatabaseConnection;
+    QBitArray resolved;
+    QBitArray available;
+    QFont fonts[QPlatformTheme::NFonts];
+};
+
+Q_GLOBAL_STATIC(QQuickThemeFonts, themeFonts)
+
 QFont QQuickControlPrivate::themeFont(QPlatformTheme::Font type)
 {
-    if (QPlatformTheme *theme = QGuiApplicationPrivate::platformTheme()) {
-        if (const QFont *font = theme->font(type)) {
-            QFont f = *font;
+    QQuickThemeFonts *cache = themeFonts();
+    if (!cache->fontDatabaseConnection && qGuiApp) {
+        cache->fontDatabaseConnection = QObject::connect(qGuiApp, &QGuiApplication::fontDatabaseChanged, &QQuickControlPrivate::invalidateThemeFonts);
+        cache->resolved.fill(false);
+    }
+
+    QPlatformTheme *theme = QGuiApplicationPrivate::platformTheme();
+    if (cache->theme != theme) {
+        cache->theme = theme;
+        cache->resolved.fill(false);
+    }
+
+    if (!cache->resolved.testBit(type)) {
+        const QFont *font = theme ? theme->font(type) : nullptr;
+        if (font) {
+            cache->fonts[type] = *font;
             if (type == QPlatformTheme::SystemFont)
-                f.resolve(0);
-            return f;
+                cache->fonts[type].resolve(0);
         }
+        cache->available.setBit(type, font);
+        cache->resolved.setBit(type);
     }
 
-    return QFont();
+    // the application font can change at any time, so it is not cached
+    if (!cache->available.testBit(type))
+        return QFont();
+
+    return cache->fonts[type];
+}
+
+void QQuickControlPrivate::invalidateThemeFonts()
+{
+    if (themeFonts.exists())
+        themeFonts()->resolved.fill(false);
 }
 
 /*!
@@ -509,7 +556,7 @@ void QQuickControl::itemChange(QQuickItem::ItemChange change, const QQuickItem::
         }
         break;
     case ItemActiveFocusHasChanged:
-        if (isKeyFocusReason(d->focusReason))
+        if (isKeyFocusReason(static_cast<Qt::FocusReason>(d->focusReason)))
             emit visualFocusChanged();
         break;
     default:
@@ -899,7 +946,7 @@ void QQuickControl::setFocusPolicy(Qt::FocusPolicy policy)
 Qt::FocusReason QQuickControl::focusReason() const
 {
     Q_D(const QQuickControl);
-    return d->focusReason;
+    return static_cast<Qt::FocusReason>(d->focusReason);
 }
 
 void QQuickControl::setFocusReason(Qt::FocusReason reason)
@@ -908,7 +955,7 @@ void QQuickControl::setFocusReason(Qt::FocusReason reason)
     if (d->focusReason == reason)
         return;
 
-    Qt::FocusReason oldReason = d->focusReason;
+    Qt::FocusReason oldReason = static_cast<Qt::FocusReason>(d->focusReason);
     d->focusReason = reason;
     emit focusReasonChanged();
     if (isKeyFocusReason(oldReason) != isKeyFocusReason(reason))
@@ -932,7 +979,7 @@ void QQuickControl::setFocusReason(Qt::FocusReason reason)
 bool QQuickControl::hasVisualFocus() const
 {
     Q_D(const QQuickControl);
-    return d->activeFocus && isKeyFocusReason(d->focusReason);
+    return d->activeFocus && isKeyFocusReason(static_cast<Qt::FocusReason>(d->focusReason));
 }
 
 /*!
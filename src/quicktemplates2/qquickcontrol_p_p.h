@@ -106,6 +106,7 @@ public:
     void inheritFont(const QFont &f);
     static QFont parentFont(const QQuickItem *item);
     static QFont themeFont(QPlatformTheme::Font type);
+    static void invalidateThemeFonts();
 
     void updateLocale(const QLocale &l, bool e);
     static void updateLocaleRecur(QQuickItem *item, const QLocale &l);
@@ -126,16 +127,19 @@ public:
     QLazilyAllocated<ExtraData> extra;
 
     QFont resolvedFont;
-    bool hasTopPadding;
-    bool hasLeftPadding;
-    bool hasRightPadding;
-    bool hasBottomPadding;
-    bool hasLocale;
-    bool wheelEnabled;
+    // packed into a single word, as there can be thousands of controls
+    bool hasTopPadding : 1;
+    bool hasLeftPadding : 1;
+    bool hasRightPadding : 1;
+    bool hasBottomPadding : 1;
+    bool hasLocale : 1;
+    bool wheelEnabled : 1;
 #if QT_CONFIG(quicktemplates2_hover)
-    bool hovered;
-    bool explicitHoverEnabled;
+    bool hovered : 1;
+    bool explicitHoverEnabled : 1;
 #endif
+    uint focusPolicy : 4; // Qt::FocusPolicy
+    uint focusReason : 4; // Qt::FocusReason
     qreal padding;
     qreal topPadding;
     qreal leftPadding;
@@ -143,8 +147,6 @@ public:
     qreal bottomPadding;
     qreal spacing;
     QLocale locale;
-    Qt::FocusPolicy focusPolicy;
-    Qt::FocusReason focusReason;
     QQuickItem *background;
     QQuickItem *contentItem;
     QQuickAccessibleAttached *accessibleAttached;
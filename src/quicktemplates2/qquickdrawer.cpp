@@ -160,31 +160,75 @@ QT_BEGIN_NAMESPACE
     \sa SwipeView, {Customizing Drawer}, {Navigation Controls}, {Popup Controls}
 */
 
+// The minimum velocity (in positions per second) at which a released drawer
+// settles. Decelerating from it to rest takes as long as the default enter
+// and exit transitions take to open or close the drawer.
+static const qreal MinimumSettleVelocity = 10.0;
+
+QQuickDrawerSettleJob::QQuickDrawerSettleJob(QQuickDrawerPrivate *drawer)
+    : drawer(drawer),
+      m_duration(0),
+      m_from(0),
+      m_to(0)
+{
+}
+
+void QQuickDrawerSettleJob::settle(qreal from, qreal to, qreal velocity)
+{
+    stop();
+
+    // decelerate uniformly from the release velocity to rest at the target
+    m_from = from;
+    m_to = to;
+    m_duration = qMax(1, qRound(2000 * qAbs(to - from) / qMax(velocity, MinimumSettleVelocity)));
+    start();
+}
+
+int QQuickDrawerSettleJob::duration() const
+{
+    return m_duration;
+}
+
+void QQuickDrawerSettleJob::updateCurrentTime(int time)
+{
+    const qreal t = qreal(time) / m_duration;
+    static_cast<QQuickDrawer *>(drawer->q_ptr)->setPosition(m_from + (m_to - m_from) * t * (2 - t));
+}
+
+void QQuickDrawerSettleJob::updateState(State newState, State oldState)
+{
+    Q_UNUSED(oldState);
+    if (newState == Stopped && currentTime() == m_duration)
+        drawer->finalizeSettle();
+}
+
 QQuickDrawerPrivate::QQuickDrawerPrivate()
     : edge(Qt::LeftEdge),
       offset(0),
       position(0),
-      dragMargin(QGuiApplication::styleHints()->startDragDistance())
+      dragMargin(QGuiApplication::styleHints()->startDragDistance()),
+      dragExtent(0),
+      dragWindowExtent(0),
+      moving(false),
+      settleJob(this)
 {
     setEdge(Qt::LeftEdge);
 }
 
 qreal QQuickDrawerPrivate::positionAt(const QPointF &point) const
 {
-    Q_Q(const QQuickDrawer);
-    QQuickWindow *window = q->window();
-    if (!window)
+    if (qFuzzyIsNull(dragExtent))
         return 0;
 
     switch (edge) {
     case Qt::TopEdge:
-        return point.y() / q->height();
+        return point.y() / dragExtent;
     case Qt::LeftEdge:
-        return point.x() / q->width();
+        return point.x() / dragExtent;
     case Qt::RightEdge:
-        return (window->width() - point.x()) / q->width();
+        return (dragWindowExtent - point.x()) / dragExtent;
     case Qt::BottomEdge:
-        return (window->height() - point.y()) / q->height();
+        return (dragWindowExtent - point.y()) / dragExtent;
     default:
         return 0;
     }
@@ -215,6 +259,43 @@ void QQuickDrawerPrivate::reposition()
     QQuickPopupPrivate::reposition();
 }
 
+/*
+    Moves the popup item to the current position while the drawer is being
+    dragged or settled. Only the position along the drag axis changes, so
+    the popup item is moved directly without a full positioner pass and
+    without resizing the dimmer.
+*/
+void QQuickDrawerPrivate::moveToPosition()
+{
+    Q_Q(QQuickDrawer);
+    moving = true;
+    switch (edge) {
+    case Qt::LeftEdge:
+        popupItem->setX((position - 1.0) * popupItem->width());
+        break;
+    case Qt::RightEdge:
+        popupItem->setX(dragWindowExtent - position * popupItem->width());
+        break;
+    case Qt::TopEdge:
+        popupItem->setY((position - 1.0) * popupItem->height());
+        break;
+    case Qt::BottomEdge:
+        popupItem->setY(dragWindowExtent - position * popupItem->height());
+        break;
+    }
+    moving = false;
+
+    const QPointF effectivePos = parentItem ? parentItem->mapFromScene(popupItem->position()) : popupItem->position();
+    if (!qFuzzyCompare(effectiveX, effectivePos.x())) {
+        effectiveX = effectivePos.x();
+        emit q->xChanged();
+    }
+    if (!qFuzzyCompare(effectiveY, effectivePos.y())) {
+        effectiveY = effectivePos.y();
+        emit q->yChanged();
+    }
+}
+
 void QQuickDrawerPrivate::resizeOverlay()
 {
     if (!dimmer || !window)
@@ -265,6 +346,7 @@ bool QQuickDrawerPrivate::startDrag(QQuickWindow *window, QMouseEvent *event)
     if (drag) {
         prepareEnterTransition();
         reposition();
+        cacheDragGeometry();
         handleMousePressEvent(window->contentItem(), event);
     }
 
@@ -329,34 +411,22 @@ bool QQuickDrawerPrivate::ungrabMouse(QMouseEvent *event)
             velocity = -velocity;
 
         if (position > 0.7 || velocity > openCloseVelocityThreshold) {
-            transitionManager.transitionEnter();
+            settle(true, velocity);
         } else if (position < 0.3 || velocity < -openCloseVelocityThreshold) {
-            transitionManager.transitionExit();
+            settle(false, velocity);
         } else {
             switch (edge) {
             case Qt::LeftEdge:
-                if (releasePoint.x() - pressPoint.x() > 0)
-                    transitionManager.transitionEnter();
-                else
-                    transitionManager.transitionExit();
+                settle(releasePoint.x() - pressPoint.x() > 0, velocity);
                 break;
             case Qt::RightEdge:
-                if (releasePoint.x() - pressPoint.x() < 0)
-                    transitionManager.transitionEnter();
-                else
-                    transitionManager.transitionExit();
+                settle(releasePoint.x() - pressPoint.x() < 0, velocity);
                 break;
             case Qt::TopEdge:
-                if (releasePoint.y() - pressPoint.y() > 0)
-                    transitionManager.transitionEnter();
-                else
-                    transitionManager.transitionExit();
+                settle(releasePoint.y() - pressPoint.y() > 0, velocity);
                 break;
             case Qt::BottomEdge:
-                if (releasePoint.y() - pressPoint.y() < 0)
-                    transitionManager.transitionEnter();
-                else
-                    transitionManager.transitionExit();
+                settle(releasePoint.y() - pressPoint.y() < 0, velocity);
                 break;
             }
         }
@@ -364,6 +434,52 @@ bool QQuickDrawerPrivate::ungrabMouse(QMouseEvent *event)
     return wasGrabbed;
 }
 
+/*
+    Caches the geometry that drag moves depend on when a drag starts,
+    so that it is not queried again on every move.
+*/
+void QQuickDrawerPrivate::cacheDragGeometry()
+{
+    Q_Q(QQuickDrawer);
+    if (!window) {
+        dragExtent = 0;
+        dragWindowExtent = 0;
+    } else if (edge == Qt::LeftEdge || edge == Qt::RightEdge) {
+        dragExtent = q->width();
+        dragWindowExtent = window->width();
+    } else {
+        dragExtent = q->height();
+        dragWindowExtent = window->height();
+    }
+}
+
+/*
+    Settles a released drawer open or closed. Instead of running the enter or
+    exit transition, the drawer decelerates from the release velocity (in pixels
+    per second, positive towards open) to rest, driven by the animation timer.
+    The enter or exit transition is finalized once the drawer has come to rest.
+*/
+void QQuickDrawerPrivate::settle(bool open, qreal velocity)
+{
+    if (transitionManager.isRunning())
+        transitionManager.cancel();
+
+    if (open ? !prepareEnterTransition() : !prepareExitTransition())
+        return;
+
+    const qreal speed = qFuzzyIsNull(dragExtent) ? 0 : (open ? velocity : -velocity) / dragExtent;
+    settleJob.settle(position, open ? 1.0 : 0.0, speed);
+}
+
+void QQuickDrawerPrivate::finalizeSettle()
+{
+    reposition();
+    if (transitionState == EnterTransition)
+        finalizeEnterTransition();
+    else if (transitionState == ExitTransition)
+        finalizeExitTransition();
+}
+
 bool QQuickDrawerPrivate::handleMousePressEvent(QQuickItem *item, QMouseEvent *event)
 {
     offset = 0;
@@ -390,12 +506,15 @@ bool QQuickDrawerPrivate::handleMouseMoveEvent(QQuickItem *item, QMouseEvent *ev
         return true;
 
     const QPointF movePoint = event->windowPos();
+    velocityCalculator.addSample(movePoint, event->timestamp());
 
-    if (grabMouse(event)) {
+    if (!popupItem->keepMouseGrab() && grabMouse(event)) {
         QQuickItem *grabber = window->mouseGrabberItem();
         if (!grabber || !grabber->keepMouseGrab()) {
             popupItem->grabMouse();
             popupItem->setKeepMouseGrab(true);
+            settleJob.stop();
+            cacheDragGeometry();
             offset = qMin<qreal>(0.0, positionAt(movePoint) - position);
         }
     }
@@ -443,6 +562,7 @@ static QList<QQuickStateAction> prepareTransition(QQuickDrawer *drawer, QQuickTr
 bool QQuickDrawerPrivate::prepareEnterTransition()
 {
     Q_Q(QQuickDrawer);
+    settleJob.stop();
     enterActions = prepareTransition(q, enter, 1.0);
     return QQuickPopupPrivate::prepareEnterTransition();
 }
@@ -450,6 +570,7 @@ bool QQuickDrawerPrivate::prepareEnterTransition()
 bool QQuickDrawerPrivate::prepareExitTransition()
 {
     Q_Q(QQuickDrawer);
+    settleJob.stop();
     exitActions = prepareTransition(q, exit, 0.0);
     return QQuickPopupPrivate::prepareExitTransition();
 }
@@ -529,8 +650,12 @@ void QQuickDrawer::setPosition(qreal position)
         return;
 
     d->position = position;
-    if (isComponentComplete())
-        d->reposition();
+    if (isComponentComplete()) {
+        if (d->popupItem->keepMouseGrab() || d->settleJob.isRunning())
+            d->moveToPosition();
+        else
+            d->reposition();
+    }
     if (d->dimmer)
         d->dimmer->setOpacity(position);
     emit positionChanged();
@@ -660,6 +785,9 @@ bool QQuickDrawer::overlayEvent(QQuickItem *item, QEvent *event)
 void QQuickDrawer::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
 {
     Q_D(QQuickDrawer);
+    if (d->moving && newGeometry.size() == oldGeometry.size())
+        return;
+
     QQuickPopup::geometryChanged(newGeometry, oldGeometry);
     d->resizeOverlay();
 }
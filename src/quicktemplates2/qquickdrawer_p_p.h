@@ -51,9 +51,32 @@
 #include <QtQuickTemplates2/private/qquickdrawer_p.h>
 #include <QtQuickTemplates2/private/qquickpopup_p_p.h>
 #include <QtQuickTemplates2/private/qquickvelocitycalculator_p_p.h>
+#include <QtQml/private/qabstractanimationjob_p.h>
 
 QT_BEGIN_NAMESPACE
 
+class QQuickDrawerPrivate;
+
+class QQuickDrawerSettleJob : public QAbstractAnimationJob
+{
+public:
+    QQuickDrawerSettleJob(QQuickDrawerPrivate *drawer);
+
+    void settle(qreal from, qreal to, qreal velocity);
+
+    int duration() const override;
+
+protected:
+    void updateCurrentTime(int time) override;
+    void updateState(State newState, State oldState) override;
+
+private:
+    QQuickDrawerPrivate *drawer;
+    int m_duration;
+    qreal m_from;
+    qreal m_to;
+};
+
 class QQuickDrawerPrivate : public QQuickPopupPrivate
 {
     Q_DECLARE_PUBLIC(QQuickDrawer)
@@ -68,11 +91,16 @@ public:
 
     qreal positionAt(const QPointF &point) const;
     void reposition() override;
+    void moveToPosition();
     void resizeOverlay() override;
 
     bool startDrag(QQuickWindow *window, QMouseEvent *event);
     bool grabMouse(QMouseEvent *event);
     bool ungrabMouse(QMouseEvent *event);
+    void cacheDragGeometry();
+
+    void settle(bool open, qreal velocity);
+    void finalizeSettle();
 
     bool handleMousePressEvent(QQuickItem *item, QMouseEvent *event);
     bool handleMouseMoveEvent(QQuickItem *item, QMouseEvent *event);
@@ -87,8 +115,12 @@ public:
     qreal offset;
     qreal position;
     qreal dragMargin;
+    qreal dragExtent;
+    qreal dragWindowExtent;
+    bool moving;
     QPointF pressPoint;
     QQuickVelocityCalculator velocityCalculator;
+    QQuickDrawerSettleJob settleJob;
 };
 
 QT_END_NAMESPACE
@@ -39,6 +39,8 @@
 #include "qquickmenuitem_p.h"
 
 #include <QtGui/qevent.h>
+#include <QtQml/qjsvalue.h>
+#include <QtQml/private/qqmldelegatemodel_p.h>
 #include <QtQml/private/qqmlobjectmodel_p.h>
 #include <QtQuick/private/qquickitem_p.h>
 #include <QtQuick/private/qquickitemchangelistener_p.h>
@@ -98,17 +100,54 @@ QT_BEGIN_NAMESPACE
     Although \l {MenuItem}{MenuItems} are most commonly used with Menu, it can
     contain any type of item.
 
+    \section1 Model-driven Menus
+
+    Menus with a large or dynamic number of entries, such as a list of recently
+    opened files, can be populated from a \l model instead. The menu items are
+    created from the \l delegate on demand, and only for the part of the model
+    that is visible in the menu.
+
+    \code
+    Menu {
+        id: recentFilesMenu
+        model: recentFilesModel
+        delegate: MenuItem {
+            text: model.fileName
+            onTriggered: openFile(model.filePath)
+        }
+    }
+    \endcode
+
     \sa {Customizing Menu}, {Menu Controls}, {Popup Controls}
 */
 
+static const QQuickItemPrivate::ChangeTypes delegateChangeTypes = QQuickItemPrivate::ImplicitWidth;
+
 QQuickMenuPrivate::QQuickMenuPrivate()
     : contentItem(nullptr),
-      contentModel(nullptr)
+      contentModel(nullptr),
+      delegate(nullptr),
+      delegateModel(nullptr),
+      modelDriven(false),
+      sampledWidth(0),
+      originalImplicitWidth(0)
 {
     Q_Q(QQuickMenu);
     contentModel = new QQmlObjectModel(q);
 }
 
+QQuickItemView *QQuickMenuPrivate::view() const
+{
+    return qobject_cast<QQuickItemView *>(contentItem);
+}
+
+int QQuickMenuPrivate::count() const
+{
+    if (modelDriven)
+        return delegateModel->count();
+    return contentModel->count();
+}
+
 QQuickItem *QQuickMenuPrivate::itemAt(int index) const
 {
     return qobject_cast<QQuickItem *>(contentModel->get(index));
@@ -177,6 +216,120 @@ void QQuickMenuPrivate::resizeItems()
         resizeItem(itemAt(i));
 }
 
+/*
+    A model-driven menu presents a delegate model of its own through the
+    contentModel property, so the view of the style keeps its binding to
+    contentModel. Owning the delegate model also means that only the items
+    created from the delegate are handled as menu items, and not the
+    header, footer, highlight or section items of the view.
+*/
+void QQuickMenuPrivate::updateDelegateModel()
+{
+    Q_Q(QQuickMenu);
+    const bool wasModelDriven = modelDriven;
+    modelDriven = delegate && model.isValid();
+
+    if (modelDriven) {
+        if (!delegateModel) {
+            delegateModel = new QQmlDelegateModel(qmlContext(q), q);
+            QObjectPrivate::connect(delegateModel, &QQmlInstanceModel::createdItem, this, &QQuickMenuPrivate::onDelegateItemCreated);
+            QObjectPrivate::connect(delegateModel, &QQmlInstanceModel::destroyingItem, this, &QQuickMenuPrivate::onDelegateItemDestroying);
+            delegateModel->componentComplete();
+        }
+        delegateModel->setModel(model);
+        delegateModel->setDelegate(delegate);
+    }
+
+    if (modelDriven == wasModelDriven)
+        return;
+
+    if (modelDriven)
+        beginSampling(contentItem);
+    else
+        endSampling(contentItem);
+
+    emit q->contentModelChanged();
+
+    // the view has released the delegates by now
+    if (!modelDriven)
+        delegateModel->setModel(QVariant());
+}
+
+void QQuickMenuPrivate::onDelegateItemCreated(int, QObject *object)
+{
+    QQuickItem *item = qobject_cast<QQuickItem *>(object);
+    if (!item)
+        return;
+
+    delegateItems.append(item);
+    QQuickItemPrivate::get(item)->addItemChangeListener(this, delegateChangeTypes);
+    resizeItem(item);
+    sampleImplicitWidth(item);
+
+    QQuickMenuItem *menuItem = qobject_cast<QQuickMenuItem *>(item);
+    if (menuItem) {
+        Q_Q(QQuickMenu);
+        QObjectPrivate::connect(menuItem, &QQuickMenuItem::pressed, this, &QQuickMenuPrivate::onItemPressed);
+        QObject::connect(menuItem, &QQuickMenuItem::triggered, q, &QQuickPopup::close);
+        QObjectPrivate::connect(menuItem, &QQuickItem::activeFocusChanged, this, &QQuickMenuPrivate::onItemActiveFocusChanged);
+    }
+}
+
+void QQuickMenuPrivate::onDelegateItemDestroying(QObject *object)
+{
+    QQuickItem *item = qobject_cast<QQuickItem *>(object);
+    if (!item || !delegateItems.removeOne(item))
+        return;
+
+    QQuickItemPrivate::get(item)->removeItemChangeListener(this, delegateChangeTypes);
+
+    QQuickMenuItem *menuItem = qobject_cast<QQuickMenuItem *>(item);
+    if (menuItem) {
+        Q_Q(QQuickMenu);
+        QObjectPrivate::disconnect(menuItem, &QQuickMenuItem::pressed, this, &QQuickMenuPrivate::onItemPressed);
+        QObject::disconnect(menuItem, &QQuickMenuItem::triggered, q, &QQuickPopup::close);
+        QObjectPrivate::disconnect(menuItem, &QQuickItem::activeFocusChanged, this, &QQuickMenuPrivate::onItemActiveFocusChanged);
+    }
+}
+
+/*
+    A model-driven menu cannot measure all of its items, because most of them
+    never exist. Instead, the widest delegate seen so far determines the
+    implicit width of the view. The width only grows while the menu is in use,
+    so that scrolling through the items does not make the menu jump around.
+    The original implicit width is restored when the menu leaves model mode.
+*/
+void QQuickMenuPrivate::beginSampling(QQuickItem *item)
+{
+    sampledWidth = 0;
+    if (!item)
+        return;
+
+    originalImplicitWidth = item->implicitWidth();
+    QQuickItemPrivate::get(item)->updateOrAddGeometryChangeListener(this, QQuickGeometryChange::Width);
+}
+
+void QQuickMenuPrivate::endSampling(QQuickItem *item)
+{
+    if (item) {
+        QQuickItemPrivate::get(item)->removeItemChangeListener(this, QQuickItemPrivate::Geometry);
+        if (sampledWidth > 0)
+            item->setImplicitWidth(originalImplicitWidth);
+    }
+    sampledWidth = 0;
+}
+
+void QQuickMenuPrivate::sampleImplicitWidth(QQuickItem *item)
+{
+    const qreal width = item->implicitWidth();
+    if (width <= sampledWidth)
+        return;
+
+    sampledWidth = width;
+    if (contentItem)
+        contentItem->setImplicitWidth(qMax(originalImplicitWidth, sampledWidth));
+}
+
 void QQuickMenuPrivate::itemChildAdded(QQuickItem *, QQuickItem *child)
 {
     // add dynamically reparented items (eg. by a Repeater)
@@ -184,6 +337,12 @@ void QQuickMenuPrivate::itemChildAdded(QQuickItem *, QQuickItem *child)
         insertItem(contentModel->count(), child);
 }
 
+void QQuickMenuPrivate::itemImplicitWidthChanged(QQuickItem *item)
+{
+    if (modelDriven && delegateItems.contains(item))
+        sampleImplicitWidth(item);
+}
+
 void QQuickMenuPrivate::itemParentChanged(QQuickItem *item, QQuickItem *parent)
 {
     // remove dynamically unparented items (eg. by a Repeater)
@@ -211,10 +370,18 @@ void QQuickMenuPrivate::itemDestroyed(QQuickItem *item)
         removeItem(index, item);
 }
 
-void QQuickMenuPrivate::itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &)
+void QQuickMenuPrivate::itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &)
 {
-    if (complete)
+    if (!complete || !change.widthChange())
+        return;
+
+    if (item == contentItem && modelDriven) {
+        // only the delegates that currently exist need to follow the width
+        for (QQuickItem *delegateItem : qAsConst(delegateItems))
+            resizeItem(delegateItem);
+    } else {
         resizeItems();
+    }
 }
 
 void QQuickMenuPrivate::onItemPressed()
@@ -233,6 +400,8 @@ void QQuickMenuPrivate::onItemActiveFocusChanged()
         return;
 
     int indexOfItem = contentModel->indexOf(item, nullptr);
+    if (indexOfItem == -1 && modelDriven)
+        indexOfItem = delegateModel->indexOf(item, nullptr);
     setCurrentIndex(indexOfItem);
 }
 
@@ -287,6 +456,9 @@ void QQuickMenuPrivate::contentData_clear(QQmlListProperty<QObject> *prop)
 QQuickMenu::QQuickMenu(QObject *parent)
     : QQuickPopup(*(new QQuickMenuPrivate), parent)
 {
+    Q_D(QQuickMenu);
+    // menus are re-opened frequently, so keep them in the overlay while closed
+    d->keepWarm = true;
     setFocus(true);
     setClosePolicy(CloseOnEscape | CloseOnPressOutside | CloseOnReleaseOutside);
 }
@@ -295,6 +467,9 @@ QQuickMenu::QQuickMenu(QObject *parent)
     \qmlmethod Item QtQuick.Controls::Menu::itemAt(int index)
 
     Returns the item at \a index, or \c null if it does not exist.
+
+    \note Only statically declared and dynamically added items can be accessed.
+    The items of a \l {model}{model-driven} menu are not returned.
 */
 QQuickItem *QQuickMenu::itemAt(int index) const
 {
@@ -394,11 +569,14 @@ void QQuickMenu::removeItem(int index)
     \endcode
 
     The model allows menu items to be statically declared as children of the
-    menu.
+    menu. In a \l {model}{model-driven} menu, the content model creates the
+    menu items from the \l delegate instead.
 */
 QVariant QQuickMenu::contentModel() const
 {
     Q_D(const QQuickMenu);
+    if (d->modelDriven)
+        return QVariant::fromValue(d->delegateModel);
     return QVariant::fromValue(d->contentModel);
 }
 
@@ -451,10 +629,103 @@ void QQuickMenu::setTitle(QString &title)
     emit titleChanged();
 }
 
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty model QtQuick.Controls::Menu::model
+
+    This property holds the model that provides data for a model-driven menu.
+
+    When both a model and a \l delegate have been set, the menu presents the
+    model instead of its statically declared items. Menu items are created
+    from the delegate only for the visible part of the model, and destroyed
+    again when they scroll out of view. Keyboard navigation and
+    \l currentIndex operate on the model, regardless of whether an item
+    exists for a given index.
+
+    The \l {Popup::}{contentItem} must be an item view, such as a
+    \l ListView, for model-driven menus.
+
+    \sa delegate, {qml-data-models}{Data Models}
+*/
+QVariant QQuickMenu::model() const
+{
+    Q_D(const QQuickMenu);
+    return d->model;
+}
+
+void QQuickMenu::setModel(const QVariant &m)
+{
+    Q_D(QQuickMenu);
+    QVariant model = m;
+    if (model.userType() == qMetaTypeId<QJSValue>())
+        model = model.value<QJSValue>().toVariant();
+
+    if (d->model == model)
+        return;
+
+    d->model = model;
+    if (isComponentComplete())
+        d->updateDelegateModel();
+    emit modelChanged();
+}
+
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty Component QtQuick.Controls::Menu::delegate
+
+    This property holds the delegate that is used to create menu items for the
+    entries of the \l model. Triggering a \l MenuItem created from the
+    delegate closes the menu.
+
+    \sa model
+*/
+QQmlComponent *QQuickMenu::delegate() const
+{
+    Q_D(const QQuickMenu);
+    return d->delegate;
+}
+
+void QQuickMenu::setDelegate(QQmlComponent *delegate)
+{
+    Q_D(QQuickMenu);
+    if (d->delegate == delegate)
+        return;
+
+    d->delegate = delegate;
+    if (isComponentComplete())
+        d->updateDelegateModel();
+    emit delegateChanged();
+}
+
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty int QtQuick.Controls::Menu::currentIndex
+
+    This property holds the index of the currently highlighted item, or \c -1
+    if there is none. The current index is reset to \c -1 when the menu is
+    closed.
+
+    In a \l {model}{model-driven} menu, the index refers to the model, and the
+    item for it does not need to exist.
+*/
+int QQuickMenu::currentIndex() const
+{
+    Q_D(const QQuickMenu);
+    return d->contentItem ? d->currentIndex() : -1;
+}
+
+void QQuickMenu::setCurrentIndex(int index)
+{
+    Q_D(QQuickMenu);
+    if (d->contentItem)
+        d->setCurrentIndex(index);
+}
+
 void QQuickMenu::componentComplete()
 {
     Q_D(QQuickMenu);
     QQuickPopup::componentComplete();
+    d->updateDelegateModel();
     d->resizeItems();
 }
 
@@ -463,12 +734,22 @@ void QQuickMenu::contentItemChange(QQuickItem *newItem, QQuickItem *oldItem)
     Q_D(QQuickMenu);
     QQuickPopup::contentItemChange(newItem, oldItem);
 
-    if (oldItem)
+    if (d->modelDriven)
+        d->endSampling(oldItem);
+    if (oldItem) {
         QQuickItemPrivate::get(oldItem)->removeItemChangeListener(d, QQuickItemPrivate::Children);
-    if (newItem)
+        if (QQuickItemView *oldView = qobject_cast<QQuickItemView *>(oldItem))
+            disconnect(oldView, &QQuickItemView::currentIndexChanged, this, &QQuickMenu::currentIndexChanged);
+    }
+    if (newItem) {
         QQuickItemPrivate::get(newItem)->addItemChangeListener(d, QQuickItemPrivate::Children);
+        if (QQuickItemView *newView = qobject_cast<QQuickItemView *>(newItem))
+            connect(newView, &QQuickItemView::currentIndexChanged, this, &QQuickMenu::currentIndexChanged);
+    }
 
     d->contentItem = newItem;
+    if (d->modelDriven)
+        d->beginSampling(newItem);
 }
 
 void QQuickMenu::itemChange(QQuickItem::ItemChange change, const QQuickItem::ItemChangeData &data)
@@ -495,7 +776,7 @@ void QQuickMenu::keyReleaseEvent(QKeyEvent *event)
 {
     Q_D(QQuickMenu);
     QQuickPopup::keyReleaseEvent(event);
-    if (d->contentModel->count() == 0)
+    if (d->count() == 0)
         return;
 
     // QTBUG-17051
@@ -519,8 +800,13 @@ void QQuickMenu::keyReleaseEvent(QKeyEvent *event)
         break;
     }
 
-    int index = d->currentIndex();
-    QQuickItem *item = itemAt(index);
+    // the items of a model-driven menu are only accessible through the view
+    QQuickItem *item = nullptr;
+    QQuickItemView *view = d->view();
+    if (d->modelDriven && view)
+        item = view->currentItem();
+    else
+        item = itemAt(d->currentIndex());
     if (item)
         item->forceActiveFocus();
 }
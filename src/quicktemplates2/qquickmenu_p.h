@@ -55,15 +55,19 @@
 
 QT_BEGIN_NAMESPACE
 
+class QQmlComponent;
 class QQuickMenuItem;
 class QQuickMenuPrivate;
 
 class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickMenu : public QQuickPopup
 {
     Q_OBJECT
-    Q_PROPERTY(QVariant contentModel READ contentModel CONSTANT FINAL)
+    Q_PROPERTY(QVariant contentModel READ contentModel NOTIFY contentModelChanged FINAL)
     Q_PROPERTY(QQmlListProperty<QObject> contentData READ contentData FINAL)
     Q_PROPERTY(QString title READ title WRITE setTitle NOTIFY titleChanged)
+    Q_PROPERTY(QVariant model READ model WRITE setModel NOTIFY modelChanged FINAL REVISION 3)
+    Q_PROPERTY(QQmlComponent *delegate READ delegate WRITE setDelegate NOTIFY delegateChanged FINAL REVISION 3)
+    Q_PROPERTY(int currentIndex READ currentIndex WRITE setCurrentIndex NOTIFY currentIndexChanged FINAL REVISION 3)
     Q_CLASSINFO("DefaultProperty", "contentData")
 
 public:
@@ -81,6 +85,15 @@ public:
     QString title() const;
     void setTitle(QString &title);
 
+    QVariant model() const;
+    void setModel(const QVariant &model);
+
+    QQmlComponent *delegate() const;
+    void setDelegate(QQmlComponent *delegate);
+
+    int currentIndex() const;
+    void setCurrentIndex(int index);
+
 protected:
     void componentComplete() override;
     void contentItemChange(QQuickItem *newItem, QQuickItem *oldItem) override;
@@ -89,6 +102,10 @@ protected:
 
 Q_SIGNALS:
     void titleChanged();
+    Q_REVISION(3) void contentModelChanged();
+    Q_REVISION(3) void modelChanged();
+    Q_REVISION(3) void delegateChanged();
+    Q_REVISION(3) void currentIndexChanged();
 
 protected:
 #if QT_CONFIG(accessibility)
@@ -55,7 +55,10 @@
 
 QT_BEGIN_NAMESPACE
 
+class QQmlComponent;
+class QQmlDelegateModel;
 class QQmlObjectModel;
+class QQuickItemView;
 
 class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickMenuPrivate : public QQuickPopupPrivate
 {
@@ -64,6 +67,9 @@ class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickMenuPrivate : public QQuickPopupPri
 public:
     QQuickMenuPrivate();
 
+    QQuickItemView *view() const;
+    int count() const;
+
     QQuickItem *itemAt(int index) const;
     void insertItem(int index, QQuickItem *item);
     void moveItem(int from, int to);
@@ -72,7 +78,16 @@ public:
     void resizeItem(QQuickItem *item);
     void resizeItems();
 
+    void updateDelegateModel();
+    void onDelegateItemCreated(int index, QObject *object);
+    void onDelegateItemDestroying(QObject *object);
+
+    void beginSampling(QQuickItem *item);
+    void endSampling(QQuickItem *item);
+    void sampleImplicitWidth(QQuickItem *item);
+
     void itemChildAdded(QQuickItem *item, QQuickItem *child) override;
+    void itemImplicitWidthChanged(QQuickItem *item) override;
     void itemSiblingOrderChanged(QQuickItem *item) override;
     void itemParentChanged(QQuickItem *item, QQuickItem *parent) override;
     void itemDestroyed(QQuickItem *item) override;
@@ -93,6 +108,13 @@ public:
     QVector<QObject *> contentData;
     QQmlObjectModel *contentModel;
     QString title;
+    QVariant model;
+    QQmlComponent *delegate;
+    QQmlDelegateModel *delegateModel;
+    QVector<QQuickItem *> delegateItems;
+    bool modelDriven;
+    qreal sampledWidth;
+    qreal originalImplicitWidth;
 };
 
 QT_END_NAMESPACE
@@ -38,6 +38,7 @@
 #include "qquickoverlay_p_p.h"
 #include "qquickpopupitem_p_p.h"
 #include "qquickpopup_p_p.h"
+#include "qquickpopuppositioner_p_p.h"
 #include "qquickdrawer_p_p.h"
 #include "qquickapplicationwindow_p.h"
 #include <QtQml/qqmlinfo.h>
@@ -73,6 +74,14 @@ void QQuickOverlayPrivate::popupAboutToHide()
         QQmlProperty::write(p->dimmer, QStringLiteral("opacity"), 0.0);
 }
 
+static void attachDimmer(QQuickItem *item, QQuickPopup *popup, QQuickItem *parent)
+{
+    item->setOpacity(popup->isVisible() ? 1.0 : 0.0);
+    item->setParentItem(parent);
+    item->stackBefore(popup->popupItem());
+    item->setZ(popup->z());
+}
+
 static QQuickItem *createDimmer(QQmlComponent *component, QQuickPopup *popup, QQuickItem *parent)
 {
     QQuickItem *item = nullptr;
@@ -91,10 +100,7 @@ static QQuickItem *createDimmer(QQmlComponent *component, QQuickPopup *popup, QQ
         item = new QQuickItem;
 
     if (item) {
-        item->setOpacity(popup->isVisible() ? 1.0 : 0.0);
-        item->setParentItem(parent);
-        item->stackBefore(popup->popupItem());
-        item->setZ(popup->z());
+        attachDimmer(item, popup, parent);
         if (popup->isModal()) {
             item->setAcceptedMouseButtons(Qt::AllButtons);
 #if QT_CONFIG(cursor)
@@ -117,21 +123,47 @@ void QQuickOverlayPrivate::createOverlay(QQuickPopup *popup)
 {
     Q_Q(QQuickOverlay);
     QQuickPopupPrivate *p = QQuickPopupPrivate::get(popup);
-    if (!p->dimmer)
-        p->dimmer = createDimmer(popup->isModal() ? modal : modeless, popup, q);
+    if (!p->dimmer) {
+        // re-use the dimmer from the last time the popup was dimmed, if it is of the same kind
+        const SpareDimmer spare = spareDimmers.take(popup);
+        if (spare.item && spare.modal == popup->isModal()) {
+            p->dimmer = spare.item;
+            attachDimmer(p->dimmer, popup, q);
+        } else {
+            destroyDimmer(spare.item);
+            p->dimmer = createDimmer(popup->isModal() ? modal : modeless, popup, q);
+        }
+    }
     p->resizeOverlay();
 }
 
+/*
+    Detaches the dimmer of a popup that is closed, or no longer dimmed, and
+    keeps it for the next time the popup needs one. This way the overlay
+    components are not instantiated again every time the same popup is
+    opened, or its dim property is toggled.
+*/
 void QQuickOverlayPrivate::destroyOverlay(QQuickPopup *popup)
 {
     QQuickPopupPrivate *p = QQuickPopupPrivate::get(popup);
     if (p->dimmer) {
         p->dimmer->setParentItem(nullptr);
-        p->dimmer->deleteLater();
+        SpareDimmer &spare = spareDimmers[popup];
+        destroyDimmer(spare.item);
+        spare.item = p->dimmer;
+        spare.modal = popup->isModal();
         p->dimmer = nullptr;
     }
 }
 
+void QQuickOverlayPrivate::destroyDimmer(QQuickItem *item)
+{
+    if (item) {
+        item->setParentItem(nullptr);
+        item->deleteLater();
+    }
+}
+
 void QQuickOverlayPrivate::toggleOverlay()
 {
     Q_Q(QQuickOverlay);
@@ -144,6 +176,33 @@ void QQuickOverlayPrivate::toggleOverlay()
         createOverlay(popup);
 }
 
+void QQuickOverlayPrivate::recreateOverlay()
+{
+    Q_Q(QQuickOverlay);
+    QQuickPopup *popup = qobject_cast<QQuickPopup *>(q->sender());
+    if (!popup)
+        return;
+
+    // the modal and modeless dimmers come from different components
+    QQuickPopupPrivate *p = QQuickPopupPrivate::get(popup);
+    destroyDimmer(p->dimmer);
+    p->dimmer = nullptr;
+    if (popup->dim())
+        createOverlay(popup);
+}
+
+void QQuickOverlayPrivate::discardSpareDimmers(bool modal)
+{
+    for (auto it = spareDimmers.begin(); it != spareDimmers.end(); ) {
+        if (it->modal == modal) {
+            destroyDimmer(it->item);
+            it = spareDimmers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 QVector<QQuickPopup *> QQuickOverlayPrivate::stackingOrderPopups() const
 {
     const QList<QQuickItem *> children = paintOrderChildItems();
@@ -153,7 +212,7 @@ QVector<QQuickPopup *> QQuickOverlayPrivate::stackingOrderPopups() const
 
     for (auto it = children.crbegin(), end = children.crend(); it != end; ++it) {
         QQuickPopup *popup = qobject_cast<QQuickPopup *>((*it)->parent());
-        if (popup)
+        if (popup && !QQuickPopupPrivate::get(popup)->culled)
             popups += popup;
     }
 
@@ -177,26 +236,77 @@ void QQuickOverlayPrivate::itemGeometryChanged(QQuickItem *item, QQuickGeometryC
 
 QQuickOverlayPrivate::QQuickOverlayPrivate()
     : modal(nullptr),
-      modeless(nullptr)
+      modeless(nullptr),
+      warmPopups(nullptr)
 {
 }
 
 void QQuickOverlayPrivate::addPopup(QQuickPopup *popup)
 {
-    Q_Q(QQuickOverlay);
     allPopups += popup;
     if (QQuickDrawer *drawer = qobject_cast<QQuickDrawer *>(popup)) {
         allDrawers += drawer;
-        q->setVisible(!allDrawers.isEmpty() || !q->childItems().isEmpty());
+        updateOverlayVisibility();
     }
 }
 
 void QQuickOverlayPrivate::removePopup(QQuickPopup *popup)
 {
-    Q_Q(QQuickOverlay);
     allPopups.removeOne(popup);
+    destroyDimmer(spareDimmers.take(popup).item);
     if (allDrawers.removeOne(static_cast<QQuickDrawer *>(popup)))
-        q->setVisible(!allDrawers.isEmpty() || !q->childItems().isEmpty());
+        updateOverlayVisibility();
+}
+
+// The overlay is visible while there are drawers, or any children other
+// than popups that are kept warm (culled) while closed.
+void QQuickOverlayPrivate::updateOverlayVisibility()
+{
+    Q_Q(QQuickOverlay);
+    bool visible = !allDrawers.isEmpty();
+    for (QQuickItem *child : qAsConst(childItems)) {
+        if (visible)
+            break;
+        if (child == warmPopups)
+            continue;
+        QQuickPopup *popup = qobject_cast<QQuickPopup *>(child->parent());
+        visible = !popup || !QQuickPopupPrivate::get(popup)->culled;
+    }
+    q->setVisible(visible);
+}
+
+/*
+    Moves a closed popup that is kept warm into a hidden container in the
+    overlay. The popup item stays in the window and keeps its overlay
+    connections, but it's out of the way of the open popups.
+*/
+void QQuickOverlayPrivate::cullPopup(QQuickPopup *popup)
+{
+    Q_Q(QQuickOverlay);
+    if (!warmPopups) {
+        warmPopups = new QQuickItem;
+        warmPopups->setVisible(false);
+        warmPopups->setParent(q);
+        warmPopups->setParentItem(q);
+    }
+
+    QQuickPopupPrivate *p = QQuickPopupPrivate::get(popup);
+    p->culled = true;
+    p->popupItem->setVisible(false);
+    p->popupItem->setParentItem(warmPopups);
+}
+
+/*
+    Moves a popup that is kept warm back into the overlay. Re-parenting
+    stacks it on top of the popups that were opened while it was culled.
+*/
+void QQuickOverlayPrivate::uncullPopup(QQuickPopup *popup)
+{
+    Q_Q(QQuickOverlay);
+    QQuickPopupPrivate *p = QQuickPopupPrivate::get(popup);
+    p->popupItem->setParentItem(q);
+    p->culled = false;
+    updateOverlayVisibility();
 }
 
 void QQuickOverlayPrivate::setMouseGrabberPopup(QQuickPopup *popup)
@@ -226,6 +336,8 @@ QQuickOverlay::~QQuickOverlay()
     Q_D(QQuickOverlay);
     if (QQuickItem *parent = parentItem())
         QQuickItemPrivate::get(parent)->removeItemChangeListener(d, QQuickItemPrivate::Geometry);
+    for (const QQuickOverlayPrivate::SpareDimmer &spare : qAsConst(d->spareDimmers))
+        delete spare.item;
 }
 
 QQmlComponent *QQuickOverlay::modal() const
@@ -242,6 +354,7 @@ void QQuickOverlay::setModal(QQmlComponent *modal)
 
     delete d->modal;
     d->modal = modal;
+    d->discardSpareDimmers(true);
     emit modalChanged();
 }
 
@@ -259,6 +372,7 @@ void QQuickOverlay::setModeless(QQmlComponent *modeless)
 
     delete d->modeless;
     d->modeless = modeless;
+    d->discardSpareDimmers(false);
     emit modelessChanged();
 }
 
@@ -293,24 +407,30 @@ void QQuickOverlay::itemChange(ItemChange change, const ItemChangeData &data)
     QQuickPopup *popup = nullptr;
     if (change == ItemChildAddedChange || change == ItemChildRemovedChange) {
         popup = qobject_cast<QQuickPopup *>(data.item->parent());
-        setVisible(!d->allDrawers.isEmpty() || !childItems().isEmpty());
+        d->updateOverlayVisibility();
     }
     if (!popup)
         return;
 
+    // a popup that is kept warm stays connected while it's culled
+    const bool culled = QQuickPopupPrivate::get(popup)->culled;
     if (change == ItemChildAddedChange) {
         if (popup->dim())
             d->createOverlay(popup);
+        if (culled)
+            return;
         QObjectPrivate::connect(popup, &QQuickPopup::dimChanged, d, &QQuickOverlayPrivate::toggleOverlay);
-        QObjectPrivate::connect(popup, &QQuickPopup::modalChanged, d, &QQuickOverlayPrivate::toggleOverlay);
+        QObjectPrivate::connect(popup, &QQuickPopup::modalChanged, d, &QQuickOverlayPrivate::recreateOverlay);
         if (!qobject_cast<QQuickDrawer *>(popup)) {
             QObjectPrivate::connect(popup, &QQuickPopup::aboutToShow, d, &QQuickOverlayPrivate::popupAboutToShow);
             QObjectPrivate::connect(popup, &QQuickPopup::aboutToHide, d, &QQuickOverlayPrivate::popupAboutToHide);
         }
     } else if (change == ItemChildRemovedChange) {
         d->destroyOverlay(popup);
+        if (culled)
+            return;
         QObjectPrivate::disconnect(popup, &QQuickPopup::dimChanged, d, &QQuickOverlayPrivate::toggleOverlay);
-        QObjectPrivate::disconnect(popup, &QQuickPopup::modalChanged, d, &QQuickOverlayPrivate::toggleOverlay);
+        QObjectPrivate::disconnect(popup, &QQuickPopup::modalChanged, d, &QQuickOverlayPrivate::recreateOverlay);
         if (!qobject_cast<QQuickDrawer *>(popup)) {
             QObjectPrivate::disconnect(popup, &QQuickPopup::aboutToShow, d, &QQuickOverlayPrivate::popupAboutToShow);
             QObjectPrivate::disconnect(popup, &QQuickPopup::aboutToHide, d, &QQuickOverlayPrivate::popupAboutToHide);
@@ -326,6 +446,17 @@ void QQuickOverlay::geometryChanged(const QRectF &newGeometry, const QRectF &old
         QQuickPopupPrivate::get(popup)->resizeOverlay();
 }
 
+void QQuickOverlay::updatePolish()
+{
+    Q_D(QQuickOverlay);
+    // popups whose parent items or their ancestors changed geometry during this frame
+    for (QQuickPopup *popup : qAsConst(d->allPopups)) {
+        QQuickPopupPrivate *p = QQuickPopupPrivate::get(popup);
+        if (p->positioner->takeAnchorMoved())
+            p->reposition();
+    }
+}
+
 void QQuickOverlay::mousePressEvent(QMouseEvent *event)
 {
     Q_D(QQuickOverlay);
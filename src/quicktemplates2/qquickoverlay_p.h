@@ -83,6 +83,7 @@ Q_SIGNALS:
 protected:
     void itemChange(ItemChange change, const ItemChangeData &data) override;
     void geometryChanged(const QRectF &oldGeometry, const QRectF &newGeometry) override;
+    void updatePolish() override;
 
     void mousePressEvent(QMouseEvent *event) override;
     void mouseMoveEvent(QMouseEvent *event) override;
@@ -50,6 +50,7 @@
 
 #include <QtQuickTemplates2/private/qquickoverlay_p.h>
 
+#include <QtCore/qhash.h>
 #include <QtQuick/private/qquickitem_p.h>
 #include <QtQuick/private/qquickitemchangelistener_p.h>
 
@@ -73,24 +74,39 @@ public:
     void addPopup(QQuickPopup *popup);
     void removePopup(QQuickPopup *popup);
     void setMouseGrabberPopup(QQuickPopup *popup);
+    void updateOverlayVisibility();
+    void cullPopup(QQuickPopup *popup);
+    void uncullPopup(QQuickPopup *popup);
 
     void popupAboutToShow();
     void popupAboutToHide();
 
     void createOverlay(QQuickPopup *popup);
     void destroyOverlay(QQuickPopup *popup);
+    void destroyDimmer(QQuickItem *item);
     void toggleOverlay();
+    void recreateOverlay();
+    void discardSpareDimmers(bool modal);
 
     QVector<QQuickPopup *> stackingOrderPopups() const;
     QVector<QQuickDrawer *> stackingOrderDrawers() const;
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff) override;
 
+    struct SpareDimmer
+    {
+        SpareDimmer() : item(nullptr), modal(false) { }
+        QQuickItem *item;
+        bool modal;
+    };
+
     QQmlComponent *modal;
     QQmlComponent *modeless;
+    QQuickItem *warmPopups;
     QVector<QQuickPopup *> allPopups;
     QVector<QQuickDrawer *> allDrawers;
     QPointer<QQuickPopup> mouseGrabberPopup;
+    QHash<QQuickPopup *, SpareDimmer> spareDimmers;
 };
 
 QT_END_NAMESPACE
@@ -43,6 +43,7 @@
 #include "qquickcontrol_p_p.h"
 #include "qquickdialog_p.h"
 
+#include <QtCore/qloggingcategory.h>
 #include <QtQml/qqmlinfo.h>
 #include <QtQuick/qquickitem.h>
 #include <QtQuick/private/qquicktransition_p.h>
@@ -50,6 +51,8 @@
 
 QT_BEGIN_NAMESPACE
 
+Q_LOGGING_CATEGORY(lcPopup, "qt.quick.controls.popup")
+
 /*!
     \qmltype Popup
     \inherits QtObject
@@ -225,6 +228,8 @@ QQuickPopupPrivate::QQuickPopupPrivate()
       allowHorizontalResize(true),
       hadActiveFocusBeforeExitTransition(false),
       interactive(true),
+      keepWarm(false),
+      culled(false),
       x(0),
       y(0),
       effectiveX(0),
@@ -302,13 +307,24 @@ bool QQuickPopupPrivate::prepareEnterTransition()
         return false;
 
     if (transitionState != EnterTransition) {
-        popupItem->setParentItem(QQuickOverlay::overlay(window));
+        transitionTimer.start();
+        QQuickOverlay *overlay = QQuickOverlay::overlay(window);
+        const bool warm = culled;
+        if (culled) {
+            QQuickOverlayPrivate::get(overlay)->uncullPopup(q);
+        } else {
+            popupItem->setParentItem(overlay);
+        }
+        qCDebug(lcPopup) << q << "open:" << (warm ? "uncull" : "attach") << transitionTimer.nsecsElapsed() / 1000 << "us";
         emit q->aboutToShow();
+        qCDebug(lcPopup) << q << "open: aboutToShow" << transitionTimer.nsecsElapsed() / 1000 << "us";
         visible = true;
         transitionState = EnterTransition;
         popupItem->setVisible(true);
         positioner->setParentItem(parentItem);
+        qCDebug(lcPopup) << q << "open: position" << transitionTimer.nsecsElapsed() / 1000 << "us";
         emit q->visibleChanged();
+        qCDebug(lcPopup) << q << "open: visibleChanged" << transitionTimer.nsecsElapsed() / 1000 << "us";
     }
     return true;
 }
@@ -320,6 +336,7 @@ bool QQuickPopupPrivate::prepareExitTransition()
         return false;
 
     if (transitionState != ExitTransition) {
+        transitionTimer.start();
         if (focus) {
             // The setFocus(false) call below removes any active focus before we're
             // able to check it in finalizeExitTransition.
@@ -328,6 +345,7 @@ bool QQuickPopupPrivate::prepareExitTransition()
         }
         transitionState = ExitTransition;
         emit q->aboutToHide();
+        qCDebug(lcPopup) << q << "close: aboutToHide" << transitionTimer.nsecsElapsed() / 1000 << "us";
     }
     return true;
 }
@@ -335,18 +353,27 @@ bool QQuickPopupPrivate::prepareExitTransition()
 void QQuickPopupPrivate::finalizeEnterTransition()
 {
     Q_Q(QQuickPopup);
+    qCDebug(lcPopup) << q << "open: enter transition" << transitionTimer.nsecsElapsed() / 1000 << "us";
     if (focus)
         popupItem->setFocus(true);
     transitionState = NoTransition;
     emit q->opened();
+    qCDebug(lcPopup) << q << "open: opened" << transitionTimer.nsecsElapsed() / 1000 << "us";
 }
 
 void QQuickPopupPrivate::finalizeExitTransition()
 {
     Q_Q(QQuickPopup);
+    qCDebug(lcPopup) << q << "close: exit transition" << transitionTimer.nsecsElapsed() / 1000 << "us";
     positioner->setParentItem(nullptr);
-    popupItem->setParentItem(nullptr);
-    popupItem->setVisible(false);
+    if (keepWarm && window && popupItem->parentItem()) {
+        // keep the popup item in the overlay, but cull it until re-opened
+        QQuickOverlayPrivate::get(QQuickOverlay::overlay(window))->cullPopup(q);
+    } else {
+        popupItem->setParentItem(nullptr);
+        popupItem->setVisible(false);
+    }
+    qCDebug(lcPopup) << q << "close:" << (culled ? "cull" : "detach") << transitionTimer.nsecsElapsed() / 1000 << "us";
 
     if (hadActiveFocusBeforeExitTransition && window) {
         if (!qobject_cast<QQuickPopupItem *>(window->activeFocusItem())) {
@@ -363,6 +390,7 @@ void QQuickPopupPrivate::finalizeExitTransition()
     hadActiveFocusBeforeExitTransition = false;
     emit q->visibleChanged();
     emit q->closed();
+    qCDebug(lcPopup) << q << "close: closed" << transitionTimer.nsecsElapsed() / 1000 << "us";
 }
 
 QMarginsF QQuickPopupPrivate::getMargins() const
@@ -429,6 +457,12 @@ void QQuickPopupPrivate::setWindow(QQuickWindow *newWindow)
     if (window == newWindow)
         return;
 
+    if (culled) {
+        // a warm popup must not stay in the overlay of another window
+        QQuickOverlayPrivate::get(QQuickOverlay::overlay(window))->uncullPopup(q);
+        popupItem->setParentItem(nullptr);
+    }
+
     if (window) {
         QQuickOverlay *overlay = QQuickOverlay::overlay(window);
         if (overlay)
@@ -51,6 +51,7 @@
 #include <QtQuickTemplates2/private/qquickpopup_p.h>
 #include <QtQuickTemplates2/private/qquickcontrol_p.h>
 
+#include <QtCore/qelapsedtimer.h>
 #include <QtCore/private/qobject_p.h>
 #include <QtQuick/qquickitem.h>
 #include <QtQuick/private/qquickitemchangelistener_p.h>
@@ -139,6 +140,8 @@ public:
     bool allowHorizontalResize;
     bool hadActiveFocusBeforeExitTransition;
     bool interactive;
+    bool keepWarm;
+    bool culled;
     qreal x;
     qreal y;
     qreal effectiveX;
@@ -162,6 +165,7 @@ public:
     QList<QQuickStateAction> enterActions;
     QList<QQuickStateAction> exitActions;
     QQuickPopupTransitionManager transitionManager;
+    QElapsedTimer transitionTimer;
 
     friend class QQuickPopupTransitionManager;
 };
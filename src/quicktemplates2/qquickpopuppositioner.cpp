@@ -37,20 +37,92 @@
 #include "qquickpopuppositioner_p_p.h"
 #include "qquickpopupitem_p_p.h"
 #include "qquickpopup_p_p.h"
+#include "qquickoverlay_p.h"
 
+#include <QtCore/qhash.h>
 #include <QtQuick/private/qquickitem_p.h>
 
 QT_BEGIN_NAMESPACE
 
 static const QQuickItemPrivate::ChangeTypes AncestorChangeTypes = QQuickItemPrivate::Geometry
                                                                   | QQuickItemPrivate::Parent
-                                                                  | QQuickItemPrivate::Children;
+                                                                  | QQuickItemPrivate::Destroyed;
 
 static const QQuickItemPrivate::ChangeTypes ItemChangeTypes = QQuickItemPrivate::Geometry
                                                              | QQuickItemPrivate::Parent;
 
+/*
+    Shared listener for the ancestors of popup parent items. Every ancestor
+    is listened to only once, no matter how many open popups are anchored
+    below it. Geometry changes do not reposition anything right away: the
+    affected positioners are marked dirty and the overlay of the window
+    is polished, so that all dirty popups of a window are processed in
+    a single pass (QQuickOverlay::updatePolish()) once per frame. The same
+    applies to geometry changes of the parent items themselves.
+*/
+class QQuickPopupTransformTracker : public QQuickItemChangeListener
+{
+public:
+    void track(QQuickItem *item, QQuickPopupPositioner *positioner);
+    void untrack(QQuickItem *item, QQuickPopupPositioner *positioner);
+
+protected:
+    void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange, const QRectF &) override;
+    void itemParentChanged(QQuickItem *item, QQuickItem *) override;
+    void itemDestroyed(QQuickItem *item) override;
+
+private:
+    QHash<QQuickItem *, QVector<QQuickPopupPositioner *> > m_positioners;
+};
+
+Q_GLOBAL_STATIC(QQuickPopupTransformTracker, transformTracker)
+
+void QQuickPopupTransformTracker::track(QQuickItem *item, QQuickPopupPositioner *positioner)
+{
+    QVector<QQuickPopupPositioner *> &positioners = m_positioners[item];
+    if (positioners.isEmpty())
+        QQuickItemPrivate::get(item)->addItemChangeListener(this, AncestorChangeTypes);
+    positioners += positioner;
+}
+
+void QQuickPopupTransformTracker::untrack(QQuickItem *item, QQuickPopupPositioner *positioner)
+{
+    auto it = m_positioners.find(item);
+    if (it == m_positioners.end())
+        return;
+
+    it->removeOne(positioner);
+    if (it->isEmpty()) {
+        m_positioners.erase(it);
+        QQuickItemPrivate::get(item)->removeItemChangeListener(this, AncestorChangeTypes);
+    }
+}
+
+void QQuickPopupTransformTracker::itemGeometryChanged(QQuickItem *item, QQuickGeometryChange, const QRectF &)
+{
+    const QVector<QQuickPopupPositioner *> positioners = m_positioners.value(item);
+    for (QQuickPopupPositioner *positioner : positioners)
+        positioner->markAnchorDirty();
+}
+
+void QQuickPopupTransformTracker::itemParentChanged(QQuickItem *item, QQuickItem *)
+{
+    // the positioners rebuild their ancestor chains => work on a copy
+    const QVector<QQuickPopupPositioner *> positioners = m_positioners.value(item);
+    for (QQuickPopupPositioner *positioner : positioners)
+        positioner->ancestorMoved(item);
+}
+
+void QQuickPopupTransformTracker::itemDestroyed(QQuickItem *item)
+{
+    const QVector<QQuickPopupPositioner *> positioners = m_positioners.take(item);
+    for (QQuickPopupPositioner *positioner : positioners)
+        positioner->ancestorDestroyed(item);
+}
+
 QQuickPopupPositioner::QQuickPopupPositioner(QQuickPopup *popup)
     : m_positioning(false),
+      m_anchorDirty(false),
       m_parentItem(nullptr),
       m_popup(popup)
 {
@@ -60,7 +132,7 @@ QQuickPopupPositioner::~QQuickPopupPositioner()
 {
     if (m_parentItem) {
         QQuickItemPrivate::get(m_parentItem)->removeItemChangeListener(this, ItemChangeTypes);
-        removeAncestorListeners(m_parentItem->parentItem());
+        untrackAncestors();
     }
 }
 
@@ -76,16 +148,17 @@ void QQuickPopupPositioner::setParentItem(QQuickItem *parent)
 
     if (m_parentItem) {
         QQuickItemPrivate::get(m_parentItem)->removeItemChangeListener(this, ItemChangeTypes);
-        removeAncestorListeners(m_parentItem->parentItem());
+        untrackAncestors();
     }
 
     m_parentItem = parent;
+    m_anchorDirty = false;
 
     if (!parent)
         return;
 
     QQuickItemPrivate::get(parent)->addItemChangeListener(this, ItemChangeTypes);
-    addAncestorListeners(parent->parentItem());
+    trackAncestors();
 
     if (m_popup->popupItem()->isVisible())
         reposition();
@@ -212,6 +285,9 @@ void QQuickPopupPositioner::reposition()
     }
 
     m_positioning = true;
+    m_anchorDirty = false;
+    if (m_parentItem)
+        m_anchorRect = m_parentItem->mapRectToScene(QRectF(0, 0, m_parentItem->width(), m_parentItem->height()));
 
     popupItem->setPosition(rect.topLeft());
 
@@ -233,43 +309,95 @@ void QQuickPopupPositioner::reposition()
     m_positioning = false;
 }
 
+/*
+    Returns true if the parent item or any of its ancestors has changed geometry
+    since the popup was last positioned, and the position is yet to be re-validated.
+*/
+bool QQuickPopupPositioner::isAnchorDirty() const
+{
+    return m_anchorDirty;
+}
+
+/*
+    Clears the dirty state and returns whether the parent item actually moved
+    (or was resized or scaled) in scene coordinates. Ancestors often change
+    geometry without affecting the popup at all, for example when a sibling
+    of the anchor is laid out. Such popups are not repositioned.
+*/
+bool QQuickPopupPositioner::takeAnchorMoved()
+{
+    if (!m_anchorDirty)
+        return false;
+
+    m_anchorDirty = false;
+    if (!m_parentItem || !m_popup->popupItem()->isVisible())
+        return false;
+
+    const QRectF anchorRect = m_parentItem->mapRectToScene(QRectF(0, 0, m_parentItem->width(), m_parentItem->height()));
+    return anchorRect != m_anchorRect;
+}
+
 void QQuickPopupPositioner::itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &)
 {
-    if (m_parentItem && m_popup->popupItem()->isVisible())
-        reposition();
+    markAnchorDirty();
 }
 
-void QQuickPopupPositioner::itemParentChanged(QQuickItem *, QQuickItem *parent)
+void QQuickPopupPositioner::itemParentChanged(QQuickItem *, QQuickItem *)
 {
-    addAncestorListeners(parent);
+    // the parent item itself was re-parented => its ancestor chain changed
+    untrackAncestors();
+    trackAncestors();
+
+    if (m_popup->popupItem()->isVisible())
+        reposition();
 }
 
-void QQuickPopupPositioner::itemChildRemoved(QQuickItem *item, QQuickItem *child)
+void QQuickPopupPositioner::ancestorMoved(QQuickItem *)
 {
-    if (child->isAncestorOf(m_parentItem))
-        removeAncestorListeners(item);
+    untrackAncestors();
+    trackAncestors();
+    markAnchorDirty();
 }
 
-void QQuickPopupPositioner::removeAncestorListeners(QQuickItem *item)
+/*
+    Defers repositioning to the polish pass of the window's overlay, so that
+    a burst of geometry changes costs a single reposition() per frame.
+*/
+void QQuickPopupPositioner::markAnchorDirty()
 {
-    if (item == m_parentItem)
+    if (m_anchorDirty || !m_parentItem || !m_popup->popupItem()->isVisible())
         return;
 
-    QQuickItem *p = item;
-    while (p) {
-        QQuickItemPrivate::get(p)->removeItemChangeListener(this, AncestorChangeTypes);
-        p = p->parentItem();
+    m_anchorDirty = true;
+    if (QQuickOverlay *overlay = QQuickOverlay::overlay(m_parentItem->window()))
+        overlay->polish();
+}
+
+void QQuickPopupPositioner::ancestorDestroyed(QQuickItem *ancestor)
+{
+    // the tracker has already forgotten about the item
+    m_ancestors.removeOne(ancestor);
+}
+
+void QQuickPopupPositioner::untrackAncestors()
+{
+    // the tracker may be gone already if the positioner outlives it at exit
+    if (QQuickPopupTransformTracker *tracker = transformTracker()) {
+        for (QQuickItem *ancestor : qAsConst(m_ancestors))
+            tracker->untrack(ancestor, this);
     }
+    m_ancestors.clear();
 }
 
-void QQuickPopupPositioner::addAncestorListeners(QQuickItem *item)
+void QQuickPopupPositioner::trackAncestors()
 {
-    if (item == m_parentItem)
+    if (!m_parentItem)
         return;
 
-    QQuickItem *p = item;
+    QQuickItem *p = m_parentItem->parentItem();
     while (p) {
-        QQuickItemPrivate::get(p)->addItemChangeListener(this, AncestorChangeTypes);
+        transformTracker()->track(p, this);
+        m_ancestors += p;
         p = p->parentItem();
     }
 }
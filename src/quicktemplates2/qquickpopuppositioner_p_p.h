@@ -48,6 +48,8 @@
 // We mean it.
 //
 
+#include <QtCore/qrect.h>
+#include <QtCore/qvector.h>
 #include <QtQuick/private/qquickitemchangelistener_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -66,18 +68,28 @@ public:
 
     virtual void reposition();
 
+    bool isAnchorDirty() const;
+    bool takeAnchorMoved();
+
 protected:
     void itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &) override;
     void itemParentChanged(QQuickItem *, QQuickItem *parent) override;
-    void itemChildRemoved(QQuickItem *, QQuickItem *child) override;
 
 private:
-    void removeAncestorListeners(QQuickItem *item);
-    void addAncestorListeners(QQuickItem *item);
+    friend class QQuickPopupTransformTracker;
+
+    void ancestorMoved(QQuickItem *ancestor);
+    void ancestorDestroyed(QQuickItem *ancestor);
+    void markAnchorDirty();
+    void untrackAncestors();
+    void trackAncestors();
 
     bool m_positioning;
+    bool m_anchorDirty;
     QQuickItem *m_parentItem;
     QQuickPopup *m_popup;
+    QRectF m_anchorRect;
+    QVector<QQuickItem *> m_ancestors;
 };
 
 QT_END_NAMESPACE
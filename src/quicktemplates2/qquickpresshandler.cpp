@@ -50,7 +50,11 @@ QQuickPressHandler::QQuickPressHandler()
       pressAndHoldSignalIndex(-1),
       pressedSignalIndex(-1),
       releasedSignalIndex(-1),
-      delayedMousePressEvent(nullptr)
+      hasDelayedMousePressEvent(false),
+      delayedButton(Qt::NoButton),
+      delayedButtons(Qt::NoButton),
+      delayedModifiers(Qt::NoModifier),
+      delayedTimestamp(0)
 {
 }
 
@@ -60,7 +64,11 @@ void QQuickPressHandler::mousePressEvent(QMouseEvent *event)
     pressPos = event->localPos();
     if (Qt::LeftButton == (event->buttons() & Qt::LeftButton)) {
         timer.start(QGuiApplication::styleHints()->mousePressAndHoldInterval(), control);
-        delayedMousePressEvent = new QMouseEvent(event->type(), event->pos(), event->button(), event->buttons(), event->modifiers());
+        delayedButton = event->button();
+        delayedButtons = event->buttons();
+        delayedModifiers = event->modifiers();
+        delayedTimestamp = event->timestamp();
+        hasDelayedMousePressEvent = true;
     } else {
         timer.stop();
     }
@@ -133,12 +141,16 @@ void QQuickPressHandler::timerEvent(QTimerEvent *)
     }
 }
 
+QMouseEvent QQuickPressHandler::delayedMousePressEvent() const
+{
+    QMouseEvent event(QEvent::MouseButtonPress, pressPos, delayedButton, delayedButtons, delayedModifiers);
+    event.setTimestamp(delayedTimestamp);
+    return event;
+}
+
 void QQuickPressHandler::clearDelayedMouseEvent()
 {
-    if (delayedMousePressEvent) {
-        delete delayedMousePressEvent;
-        delayedMousePressEvent = 0;
-    }
+    hasDelayedMousePressEvent = false;
 }
 
 bool QQuickPressHandler::isActive()
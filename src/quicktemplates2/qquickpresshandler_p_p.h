@@ -49,13 +49,12 @@
 //
 
 #include <QtCore/qpoint.h>
-#include <QtCore/qbasictimer.h>
+#include <QtGui/qevent.h>
+#include <QtQuickTemplates2/private/qquicktimerwheel_p_p.h>
 
 QT_BEGIN_NAMESPACE
 
 class QQuickItem;
-class QMouseEvent;
-class QTimerEvent;
 
 struct QQuickPressHandler
 {
@@ -66,17 +65,22 @@ struct QQuickPressHandler
     void mouseReleaseEvent(QMouseEvent *event);
     void timerEvent(QTimerEvent *event);
 
+    QMouseEvent delayedMousePressEvent() const;
     void clearDelayedMouseEvent();
     bool isActive();
 
     QQuickItem *control;
-    QBasicTimer timer;
+    QQuickWheelTimer timer;
     QPointF pressPos;
     bool longPress;
     int pressAndHoldSignalIndex;
     int pressedSignalIndex;
     int releasedSignalIndex;
-    QMouseEvent *delayedMousePressEvent;
+    bool hasDelayedMousePressEvent;
+    Qt::MouseButton delayedButton;
+    Qt::MouseButtons delayedButtons;
+    Qt::KeyboardModifiers delayedModifiers;
+    ulong delayedTimestamp;
 };
 
 QT_END_NAMESPACE
@@ -242,6 +242,13 @@ void QQuickScrollBarPrivate::resizeContent()
     }
 }
 
+void QQuickScrollBarPrivate::syncVisibleArea()
+{
+    Q_Q(QQuickScrollBar);
+    q->setSize(visibleArea.size());
+    q->setPosition(visibleArea.position());
+}
+
 void QQuickScrollBarPrivate::handlePress(const QPointF &point)
 {
     Q_Q(QQuickScrollBar);
@@ -709,19 +716,16 @@ void QQuickScrollBarAttachedPrivate::initHorizontal()
 
     connect(flickable, &QQuickFlickable::movingHorizontallyChanged, this, &QQuickScrollBarAttachedPrivate::activateHorizontal);
 
-    // TODO: export QQuickFlickableVisibleArea
-    QObject *area = flickable->property("visibleArea").value<QObject *>();
-    QObject::connect(area, SIGNAL(widthRatioChanged(qreal)), horizontal, SLOT(setSize(qreal)));
-    QObject::connect(area, SIGNAL(xPositionChanged(qreal)), horizontal, SLOT(setPosition(qreal)));
-
     // ensure that the ScrollBar is stacked above the Flickable in a ScrollView
     QQuickItem *parent = horizontal->parentItem();
     if (parent && parent == flickable->parentItem())
         horizontal->stackAfter(flickable);
 
     layoutHorizontal();
-    horizontal->setSize(area->property("widthRatio").toReal());
-    horizontal->setPosition(area->property("xPosition").toReal());
+
+    QQuickScrollBarPrivate *p = QQuickScrollBarPrivate::get(horizontal);
+    p->visibleArea.setFlickable(flickable, Qt::Horizontal, horizontal);
+    p->syncVisibleArea();
 }
 
 void QQuickScrollBarAttachedPrivate::initVertical()
@@ -730,19 +734,16 @@ void QQuickScrollBarAttachedPrivate::initVertical()
 
     connect(flickable, &QQuickFlickable::movingVerticallyChanged, this, &QQuickScrollBarAttachedPrivate::activateVertical);
 
-    // TODO: export QQuickFlickableVisibleArea
-    QObject *area = flickable->property("visibleArea").value<QObject *>();
-    QObject::connect(area, SIGNAL(heightRatioChanged(qreal)), vertical, SLOT(setSize(qreal)));
-    QObject::connect(area, SIGNAL(yPositionChanged(qreal)), vertical, SLOT(setPosition(qreal)));
-
     // ensure that the ScrollBar is stacked above the Flickable in a ScrollView
     QQuickItem *parent = vertical->parentItem();
     if (parent && parent == flickable->parentItem())
         vertical->stackAfter(flickable);
 
     layoutVertical();
-    vertical->setSize(area->property("heightRatio").toReal());
-    vertical->setPosition(area->property("yPosition").toReal());
+
+    QQuickScrollBarPrivate *p = QQuickScrollBarPrivate::get(vertical);
+    p->visibleArea.setFlickable(flickable, Qt::Vertical, vertical);
+    p->syncVisibleArea();
 }
 
 void QQuickScrollBarAttachedPrivate::cleanupHorizontal()
@@ -750,11 +751,7 @@ void QQuickScrollBarAttachedPrivate::cleanupHorizontal()
     Q_ASSERT(flickable && horizontal);
 
     disconnect(flickable, &QQuickFlickable::movingHorizontallyChanged, this, &QQuickScrollBarAttachedPrivate::activateHorizontal);
-
-    // TODO: export QQuickFlickableVisibleArea
-    QObject *area = flickable->property("visibleArea").value<QObject *>();
-    QObject::disconnect(area, SIGNAL(widthRatioChanged(qreal)), horizontal, SLOT(setSize(qreal)));
-    QObject::disconnect(area, SIGNAL(xPositionChanged(qreal)), horizontal, SLOT(setPosition(qreal)));
+    QQuickScrollBarPrivate::get(horizontal)->visibleArea.setFlickable(nullptr, Qt::Horizontal, nullptr);
 }
 
 void QQuickScrollBarAttachedPrivate::cleanupVertical()
@@ -762,11 +759,7 @@ void QQuickScrollBarAttachedPrivate::cleanupVertical()
     Q_ASSERT(flickable && vertical);
 
     disconnect(flickable, &QQuickFlickable::movingVerticallyChanged, this, &QQuickScrollBarAttachedPrivate::activateVertical);
-
-    // TODO: export QQuickFlickableVisibleArea
-    QObject *area = flickable->property("visibleArea").value<QObject *>();
-    QObject::disconnect(area, SIGNAL(heightRatioChanged(qreal)), vertical, SLOT(setSize(qreal)));
-    QObject::disconnect(area, SIGNAL(yPositionChanged(qreal)), vertical, SLOT(setPosition(qreal)));
+    QQuickScrollBarPrivate::get(vertical)->visibleArea.setFlickable(nullptr, Qt::Vertical, nullptr);
 }
 
 void QQuickScrollBarAttachedPrivate::activateHorizontal()
@@ -895,10 +888,12 @@ QQuickScrollBarAttached::~QQuickScrollBarAttached()
     Q_D(QQuickScrollBarAttached);
     if (d->horizontal) {
         QQuickItemPrivate::get(d->horizontal)->removeItemChangeListener(d, horizontalChangeTypes);
+        QQuickScrollBarPrivate::get(d->horizontal)->visibleArea.setFlickable(nullptr, Qt::Horizontal, nullptr);
         d->horizontal = nullptr;
     }
     if (d->vertical) {
         QQuickItemPrivate::get(d->vertical)->removeItemChangeListener(d, verticalChangeTypes);
+        QQuickScrollBarPrivate::get(d->vertical)->visibleArea.setFlickable(nullptr, Qt::Vertical, nullptr);
         d->vertical = nullptr;
     }
     d->setFlickable(nullptr);
@@ -50,6 +50,7 @@
 
 #include <QtQuickTemplates2/private/qquickscrollbar_p.h>
 #include <QtQuickTemplates2/private/qquickcontrol_p_p.h>
+#include <QtQuickTemplates2/private/qquickvisibleareatracker_p_p.h>
 #include <QtQuick/private/qquickitemchangelistener_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -73,6 +74,7 @@ public:
     void setInteractive(bool interactive);
     void updateActive();
     void resizeContent() override;
+    void syncVisibleArea();
 
     void handlePress(const QPointF &point);
     void handleMove(const QPointF &point);
@@ -91,6 +93,7 @@ public:
     Qt::Orientation orientation;
     QQuickScrollBar::SnapMode snapMode;
     QQuickScrollBar::Policy policy;
+    QQuickVisibleAreaTracker visibleArea;
 };
 
 class QQuickScrollBarAttachedPrivate : public QObjectPrivate, public QQuickItemChangeListener
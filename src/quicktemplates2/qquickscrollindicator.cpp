@@ -36,6 +36,7 @@
 
 #include "qquickscrollindicator_p.h"
 #include "qquickcontrol_p_p.h"
+#include "qquickvisibleareatracker_p_p.h"
 
 #include <QtQml/qqmlinfo.h>
 #include <QtQuick/private/qquickflickable_p.h>
@@ -143,12 +144,19 @@ public:
     {
     }
 
+    static QQuickScrollIndicatorPrivate *get(QQuickScrollIndicator *indicator)
+    {
+        return indicator->d_func();
+    }
+
     void resizeContent() override;
+    void syncVisibleArea();
 
     qreal size;
     qreal position;
     bool active;
     Qt::Orientation orientation;
+    QQuickVisibleAreaTracker visibleArea;
 };
 
 void QQuickScrollIndicatorPrivate::resizeContent()
@@ -171,6 +179,13 @@ void QQuickScrollIndicatorPrivate::resizeContent()
     }
 }
 
+void QQuickScrollIndicatorPrivate::syncVisibleArea()
+{
+    Q_Q(QQuickScrollIndicator);
+    q->setSize(visibleArea.size());
+    q->setPosition(visibleArea.position());
+}
+
 QQuickScrollIndicator::QQuickScrollIndicator(QQuickItem *parent)
     : QQuickControl(*(new QQuickScrollIndicatorPrivate), parent)
 {
@@ -440,10 +455,14 @@ QQuickScrollIndicatorAttached::~QQuickScrollIndicatorAttached()
 {
     Q_D(QQuickScrollIndicatorAttached);
     if (d->flickable) {
-        if (d->horizontal)
+        if (d->horizontal) {
             QQuickItemPrivate::get(d->horizontal)->removeItemChangeListener(d, horizontalChangeTypes);
-        if (d->vertical)
+            QQuickScrollIndicatorPrivate::get(d->horizontal)->visibleArea.setFlickable(nullptr, Qt::Horizontal, nullptr);
+        }
+        if (d->vertical) {
             QQuickItemPrivate::get(d->vertical)->removeItemChangeListener(d,verticalChangeTypes);
+            QQuickScrollIndicatorPrivate::get(d->vertical)->visibleArea.setFlickable(nullptr, Qt::Vertical, nullptr);
+        }
         // NOTE: Use removeItemChangeListener(Geometry) instead of updateOrRemoveGeometryChangeListener(Size).
         // The latter doesn't remove the listener but only resets its types. Thus, it leaves behind a dangling
         // pointer on destruction.
@@ -480,11 +499,7 @@ void QQuickScrollIndicatorAttached::setHorizontal(QQuickScrollIndicator *horizon
     if (d->horizontal && d->flickable) {
         QQuickItemPrivate::get(d->horizontal)->removeItemChangeListener(d, horizontalChangeTypes);
         QObjectPrivate::disconnect(d->flickable, &QQuickFlickable::movingHorizontallyChanged, d, &QQuickScrollIndicatorAttachedPrivate::activateHorizontal);
-
-        // TODO: export QQuickFlickableVisibleArea
-        QObject *area = d->flickable->property("visibleArea").value<QObject *>();
-        disconnect(area, SIGNAL(widthRatioChanged(qreal)), d->horizontal, SLOT(setSize(qreal)));
-        disconnect(area, SIGNAL(xPositionChanged(qreal)), d->horizontal, SLOT(setPosition(qreal)));
+        QQuickScrollIndicatorPrivate::get(d->horizontal)->visibleArea.setFlickable(nullptr, Qt::Horizontal, nullptr);
     }
 
     d->horizontal = horizontal;
@@ -497,14 +512,11 @@ void QQuickScrollIndicatorAttached::setHorizontal(QQuickScrollIndicator *horizon
         QQuickItemPrivate::get(horizontal)->addItemChangeListener(d, horizontalChangeTypes);
         QObjectPrivate::connect(d->flickable, &QQuickFlickable::movingHorizontallyChanged, d, &QQuickScrollIndicatorAttachedPrivate::activateHorizontal);
 
-        // TODO: export QQuickFlickableVisibleArea
-        QObject *area = d->flickable->property("visibleArea").value<QObject *>();
-        connect(area, SIGNAL(widthRatioChanged(qreal)), horizontal, SLOT(setSize(qreal)));
-        connect(area, SIGNAL(xPositionChanged(qreal)), horizontal, SLOT(setPosition(qreal)));
-
         d->layoutHorizontal();
-        horizontal->setSize(area->property("widthRatio").toReal());
-        horizontal->setPosition(area->property("xPosition").toReal());
+
+        QQuickScrollIndicatorPrivate *p = QQuickScrollIndicatorPrivate::get(horizontal);
+        p->visibleArea.setFlickable(d->flickable, Qt::Horizontal, horizontal);
+        p->syncVisibleArea();
     }
     emit horizontalChanged();
 }
@@ -538,11 +550,7 @@ void QQuickScrollIndicatorAttached::setVertical(QQuickScrollIndicator *vertical)
     if (d->vertical && d->flickable) {
         QQuickItemPrivate::get(d->vertical)->removeItemChangeListener(d, verticalChangeTypes);
         QObjectPrivate::disconnect(d->flickable, &QQuickFlickable::movingVerticallyChanged, d, &QQuickScrollIndicatorAttachedPrivate::activateVertical);
-
-        // TODO: export QQuickFlickableVisibleArea
-        QObject *area = d->flickable->property("visibleArea").value<QObject *>();
-        disconnect(area, SIGNAL(heightRatioChanged(qreal)), d->vertical, SLOT(setSize(qreal)));
-        disconnect(area, SIGNAL(yPositionChanged(qreal)), d->vertical, SLOT(setPosition(qreal)));
+        QQuickScrollIndicatorPrivate::get(d->vertical)->visibleArea.setFlickable(nullptr, Qt::Vertical, nullptr);
     }
 
     d->vertical = vertical;
@@ -555,14 +563,11 @@ void QQuickScrollIndicatorAttached::setVertical(QQuickScrollIndicator *vertical)
         QQuickItemPrivate::get(vertical)->addItemChangeListener(d, verticalChangeTypes);
         QObjectPrivate::connect(d->flickable, &QQuickFlickable::movingVerticallyChanged, d, &QQuickScrollIndicatorAttachedPrivate::activateVertical);
 
-        // TODO: export QQuickFlickableVisibleArea
-        QObject *area = d->flickable->property("visibleArea").value<QObject *>();
-        connect(area, SIGNAL(heightRatioChanged(qreal)), vertical, SLOT(setSize(qreal)));
-        connect(area, SIGNAL(yPositionChanged(qreal)), vertical, SLOT(setPosition(qreal)));
-
         d->layoutVertical();
-        vertical->setSize(area->property("heightRatio").toReal());
-        vertical->setPosition(area->property("yPosition").toReal());
+
+        QQuickScrollIndicatorPrivate *p = QQuickScrollIndicatorPrivate::get(vertical);
+        p->visibleArea.setFlickable(d->flickable, Qt::Vertical, vertical);
+        p->syncVisibleArea();
     }
     emit verticalChanged();
 }
@@ -36,15 +36,21 @@
 
 #include "qquickspinbox_p.h"
 #include "qquickcontrol_p_p.h"
+#include "qquicktimerwheel_p_p.h"
 
+#include <QtCore/qmath.h>
 #include <QtGui/qguiapplication.h>
 #include <QtGui/qstylehints.h>
 
 #include <QtQml/qqmlinfo.h>
+#include <QtQml/qqmlcontext.h>
+#include <QtQml/qqmlexpression.h>
 #include <QtQml/private/qqmllocale_p.h>
 #include <QtQml/private/qqmlengine_p.h>
 #include <QtQuick/private/qquicktextinput_p.h>
 
+#include <limits>
+
 QT_BEGIN_NAMESPACE
 
 // copied from qabstractbutton.cpp
@@ -112,12 +118,12 @@ public:
           to(99),
           value(0),
           stepSize(1),
-          delayTimer(0),
-          repeatTimer(0),
           touchId(-1),
           up(nullptr),
           down(nullptr),
           validator(nullptr),
+          textFromValueExpression(nullptr),
+          decimals(0),
           inputMethodHints(Qt::ImhDigitsOnly)
     {
     }
@@ -126,6 +132,11 @@ public:
     void updateValue();
     bool setValue(int value);
 
+    QString evaluateTextFromValue(int value, const QLocale &locale) const;
+    int evaluateValueFromText(const QString &text) const;
+    void updateDisplayText();
+    void setDisplayText(const QString &text);
+
     int effectiveStepSize() const;
 
     bool upEnabled() const;
@@ -148,14 +159,19 @@ public:
     int to;
     int value;
     int stepSize;
-    int delayTimer;
-    int repeatTimer;
+    QQuickWheelTimer delayTimer;
+    QQuickWheelTimer repeatTimer;
     int touchId;
     QQuickSpinButton *up;
     QQuickSpinButton *down;
     QValidator *validator;
-    mutable QJSValue textFromValue;
-    mutable QJSValue valueFromText;
+    QJSValue textFromValue;
+    QJSValue valueFromText;
+    QQmlExpression *textFromValueExpression;
+    mutable QJSValue defaultTextFromValue;
+    mutable QJSValue defaultValueFromText;
+    int decimals;
+    QString displayText;
     Qt::InputMethodHints inputMethodHints;
 };
 
@@ -170,16 +186,10 @@ void QQuickSpinBoxPrivate::updateValue()
     if (contentItem) {
         QVariant text = contentItem->property("text");
         if (text.isValid()) {
-            QQmlEngine *engine = qmlEngine(q);
-            if (engine) {
-                QV4::ExecutionEngine *v4 = QQmlEnginePrivate::getV4Engine(engine);
-                QJSValue loc(v4, QQmlLocale::wrap(v4, locale));
-                QJSValue val = q->valueFromText().call(QJSValueList() << text.toString() << loc);
-                const int oldValue = value;
-                q->setValue(val.toInt());
-                if (oldValue != value)
-                    emit q->valueModified();
-            }
+            const int oldValue = value;
+            q->setValue(evaluateValueFromText(text.toString()));
+            if (oldValue != value)
+                emit q->valueModified();
         }
     }
 }
@@ -195,6 +205,8 @@ bool QQuickSpinBoxPrivate::setValue(int newValue)
 
     value = newValue;
 
+    if (!textFromValueExpression)
+        updateDisplayText();
     updateUpEnabled();
     updateDownEnabled();
 
@@ -202,6 +214,77 @@ bool QQuickSpinBoxPrivate::setValue(int newValue)
     return true;
 }
 
+// The default conversions are done natively, so that changing the value
+// does not call into the JavaScript engine unless custom textFromValue or
+// valueFromText callbacks have been set.
+QString QQuickSpinBoxPrivate::evaluateTextFromValue(int val, const QLocale &loc) const
+{
+    if (decimals > 0)
+        return loc.toString(val / qPow(10, decimals), 'f', decimals);
+    return loc.toString(val);
+}
+
+int QQuickSpinBoxPrivate::evaluateValueFromText(const QString &text) const
+{
+    Q_Q(const QQuickSpinBox);
+    if (valueFromText.isCallable()) {
+        QQmlEngine *engine = qmlEngine(q);
+        if (!engine)
+            return value;
+        QV4::ExecutionEngine *v4 = QQmlEnginePrivate::getV4Engine(engine);
+        QJSValue loc(v4, QQmlLocale::wrap(v4, locale));
+        return valueFromText.call(QJSValueList() << text << loc).toInt();
+    }
+
+    // like Number.fromLocaleString(), invalid text results in 0
+    double number = locale.toDouble(text);
+    if (decimals > 0)
+        number = qRound64(number * qPow(10, decimals));
+    return static_cast<int>(qBound<double>(std::numeric_limits<int>::min(), number, std::numeric_limits<int>::max()));
+}
+
+// A custom textFromValue callback may depend on other properties than the
+// value and the locale. It is evaluated through a QML expression, the same
+// way as a binding to textFromValue(value, locale) would be, so that the
+// display text follows changes of any of the properties it reads, including
+// the value and the locale themselves.
+void QQuickSpinBoxPrivate::updateDisplayText()
+{
+    Q_Q(QQuickSpinBox);
+    if (!textFromValue.isCallable()) {
+        setDisplayText(evaluateTextFromValue(value, locale));
+        return;
+    }
+
+    if (!textFromValueExpression) {
+        QQmlEngine *engine = qmlEngine(q);
+        if (!engine)
+            return;
+        QQmlContext *context = new QQmlContext(engine, q);
+        context->setContextObject(q);
+        textFromValueExpression = new QQmlExpression(context, q, QStringLiteral("textFromValue(value, locale)"), q);
+        textFromValueExpression->setNotifyOnValueChanged(true);
+        QObjectPrivate::connect(textFromValueExpression, &QQmlExpression::valueChanged, this, &QQuickSpinBoxPrivate::updateDisplayText);
+    }
+
+    const QVariant text = textFromValueExpression->evaluate();
+    if (textFromValueExpression->hasError()) {
+        qmlWarning(q, textFromValueExpression->error());
+        textFromValueExpression->clearError();
+    }
+    setDisplayText(text.toString());
+}
+
+void QQuickSpinBoxPrivate::setDisplayText(const QString &text)
+{
+    Q_Q(QQuickSpinBox);
+    if (displayText == text)
+        return;
+
+    displayText = text;
+    emit q->displayTextChanged();
+}
+
 int QQuickSpinBoxPrivate::effectiveStepSize() const
 {
     return from > to ? -1 * stepSize : stepSize;
@@ -250,27 +333,20 @@ void QQuickSpinBoxPrivate::startRepeatDelay()
 {
     Q_Q(QQuickSpinBox);
     stopPressRepeat();
-    delayTimer = q->startTimer(AUTO_REPEAT_DELAY);
+    delayTimer.start(AUTO_REPEAT_DELAY, q);
 }
 
 void QQuickSpinBoxPrivate::startPressRepeat()
 {
     Q_Q(QQuickSpinBox);
     stopPressRepeat();
-    repeatTimer = q->startTimer(AUTO_REPEAT_INTERVAL);
+    repeatTimer.start(AUTO_REPEAT_INTERVAL, q);
 }
 
 void QQuickSpinBoxPrivate::stopPressRepeat()
 {
-    Q_Q(QQuickSpinBox);
-    if (delayTimer > 0) {
-        q->killTimer(delayTimer);
-        delayTimer = 0;
-    }
-    if (repeatTimer > 0) {
-        q->killTimer(repeatTimer);
-        repeatTimer = 0;
-    }
+    delayTimer.stop();
+    repeatTimer.stop();
 }
 
 bool QQuickSpinBoxPrivate::handlePress(const QPointF &point)
@@ -313,11 +389,11 @@ bool QQuickSpinBoxPrivate::handleRelease(const QPointF &point)
     bool wasPressed = up->isPressed() || down->isPressed();
     if (up->isPressed()) {
         up->setPressed(false);
-        if (repeatTimer <= 0 && ui && ui->contains(ui->mapFromItem(q, point)))
+        if (!repeatTimer.isActive() && ui && ui->contains(ui->mapFromItem(q, point)))
             q->increase();
     } else if (down->isPressed()) {
         down->setPressed(false);
-        if (repeatTimer <= 0 && di && di->contains(di->mapFromItem(q, point)))
+        if (!repeatTimer.isActive() && di && di->contains(di->mapFromItem(q, point)))
             q->decrease();
     }
     if (value != oldValue)
@@ -354,6 +430,7 @@ QQuickSpinBox::QQuickSpinBox(QQuickItem *parent)
 #if QT_CONFIG(cursor)
     setCursor(Qt::ArrowCursor);
 #endif
+    d->updateDisplayText();
 }
 
 /*!
@@ -490,15 +567,18 @@ void QQuickSpinBox::setEditable(bool editable)
     \qmlproperty Validator QtQuick.Controls::SpinBox::validator
 
     This property holds the input text validator for editable spinboxes. By
-    default, SpinBox uses \l IntValidator to accept input of integer numbers.
+    default, SpinBox uses \l DoubleValidator to accept input of numbers with
+    up to \l decimals decimals within the range of the spin box.
 
     \code
     SpinBox {
         id: control
-        validator: IntValidator {
+        validator: DoubleValidator {
             locale: control.locale.name
-            bottom: Math.min(control.from, control.to)
-            top: Math.max(control.from, control.to)
+            bottom: Math.min(control.from, control.to) / Math.pow(10, control.decimals)
+            top: Math.max(control.from, control.to) / Math.pow(10, control.decimals)
+            decimals: control.decimals
+            notation: DoubleValidator.StandardNotation
         }
     }
     \endcode
@@ -544,6 +624,13 @@ void QQuickSpinBox::setValidator(QValidator *validator)
     textFromValue: function(value, locale) { return Number(value).toLocaleString(locale, 'f', 0); }
     \endcode
 
+    As long as no custom function has been set, the conversion is done
+    natively, without calling the default function. It also takes
+    \l decimals into account, which the default function does not.
+
+    A custom function is evaluated like a binding. When it reads other
+    properties, \l displayText is updated whenever those properties change.
+
     \note When applying a custom \c textFromValue implementation for editable
     spinboxes, a matching \l valueFromText implementation must be provided
     to be able to convert the custom text back to an integer value.
@@ -553,12 +640,15 @@ void QQuickSpinBox::setValidator(QValidator *validator)
 QJSValue QQuickSpinBox::textFromValue() const
 {
     Q_D(const QQuickSpinBox);
-    if (!d->textFromValue.isCallable()) {
+    if (d->textFromValue.isCallable())
+        return d->textFromValue;
+
+    if (!d->defaultTextFromValue.isCallable()) {
         QQmlEngine *engine = qmlEngine(this);
         if (engine)
-            d->textFromValue = engine->evaluate(QStringLiteral("function(value, locale) { return Number(value).toLocaleString(locale, 'f', 0); }"));
+            d->defaultTextFromValue = engine->evaluate(QStringLiteral("function(value, locale) { return Number(value).toLocaleString(locale, 'f', 0); }"));
     }
-    return d->textFromValue;
+    return d->defaultTextFromValue;
 }
 
 void QQuickSpinBox::setTextFromValue(const QJSValue &callback)
@@ -569,7 +659,11 @@ void QQuickSpinBox::setTextFromValue(const QJSValue &callback)
         return;
     }
     d->textFromValue = callback;
+    const bool evaluated = d->textFromValueExpression;
     emit textFromValueChanged();
+    // an existing expression re-evaluates itself when notified of the change
+    if (!evaluated)
+        d->updateDisplayText();
 }
 
 /*!
@@ -592,6 +686,10 @@ void QQuickSpinBox::setTextFromValue(const QJSValue &callback)
     valueFromText: function(text, locale) { return Number.fromLocaleString(locale, text); }
     \endcode
 
+    As long as no custom function has been set, the conversion is done
+    natively, without calling the default function. It also takes
+    \l decimals into account, which the default function does not.
+
     \note When applying a custom \l textFromValue implementation for editable
     spinboxes, a matching \c valueFromText implementation must be provided
     to be able to convert the custom text back to an integer value.
@@ -601,12 +699,15 @@ void QQuickSpinBox::setTextFromValue(const QJSValue &callback)
 QJSValue QQuickSpinBox::valueFromText() const
 {
     Q_D(const QQuickSpinBox);
-    if (!d->valueFromText.isCallable()) {
+    if (d->valueFromText.isCallable())
+        return d->valueFromText;
+
+    if (!d->defaultValueFromText.isCallable()) {
         QQmlEngine *engine = qmlEngine(this);
         if (engine)
-            d->valueFromText = engine->evaluate(QStringLiteral("function(text, locale) { return Number.fromLocaleString(locale, text); }"));
+            d->defaultValueFromText = engine->evaluate(QStringLiteral("function(text, locale) { return Number.fromLocaleString(locale, text); }"));
     }
-    return d->valueFromText;
+    return d->defaultValueFromText;
 }
 
 void QQuickSpinBox::setValueFromText(const QJSValue &callback)
@@ -698,6 +799,79 @@ bool QQuickSpinBox::isInputMethodComposing() const
     return d->contentItem && d->contentItem->property("inputMethodComposing").toBool();
 }
 
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty int QtQuick.Controls::SpinBox::decimals
+
+    This property holds the number of decimals displayed by the spin box.
+    The default value is \c 0.
+
+    SpinBox keeps working on integer values; the decimals only affect how
+    the values are presented. For example, with two decimals, a \l value of
+    \c 314 is displayed as \c 3.14, and a \l stepSize of \c 5 increases and
+    decreases the displayed value by \c 0.05. Text entered by the user is
+    rounded to the nearest value that can be presented with the decimals.
+
+    \code
+    SpinBox {
+        from: 0
+        to: 10000
+        value: 314
+        stepSize: 5
+        decimals: 2
+    }
+    \endcode
+
+    The default \l validator accepts input with up to this many decimals.
+
+    \sa displayText, stepSize
+*/
+int QQuickSpinBox::decimals() const
+{
+    Q_D(const QQuickSpinBox);
+    return d->decimals;
+}
+
+void QQuickSpinBox::setDecimals(int decimals)
+{
+    Q_D(QQuickSpinBox);
+    decimals = qBound(0, decimals, 9);
+    if (d->decimals == decimals)
+        return;
+
+    d->decimals = decimals;
+    if (!d->textFromValueExpression)
+        d->updateDisplayText();
+    emit decimalsChanged();
+}
+
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty string QtQuick.Controls::SpinBox::displayText
+    \readonly
+
+    This property holds the textual value of the spin box, as returned by
+    \l textFromValue for the current \l value. Binding to this property,
+    instead of calling \l textFromValue from the content item, avoids a
+    JavaScript function call whenever the value changes.
+
+    \code
+    SpinBox {
+        id: control
+        contentItem: TextInput {
+            text: control.displayText
+        }
+    }
+    \endcode
+
+    \sa textFromValue, decimals
+*/
+QString QQuickSpinBox::displayText() const
+{
+    Q_D(const QQuickSpinBox);
+    return d->displayText;
+}
+
 /*!
     \qmlmethod void QtQuick.Controls::SpinBox::increase()
 
@@ -823,9 +997,9 @@ void QQuickSpinBox::timerEvent(QTimerEvent *event)
 {
     Q_D(QQuickSpinBox);
     QQuickControl::timerEvent(event);
-    if (event->timerId() == d->delayTimer) {
+    if (event->timerId() == d->delayTimer.timerId()) {
         d->startPressRepeat();
-    } else if (event->timerId() == d->repeatTimer) {
+    } else if (event->timerId() == d->repeatTimer.timerId()) {
         if (d->up->isPressed())
             increase();
         else if (d->down->isPressed())
@@ -933,6 +1107,14 @@ void QQuickSpinBox::contentItemChange(QQuickItem *newItem, QQuickItem *oldItem)
     }
 }
 
+void QQuickSpinBox::localeChange(const QLocale &newLocale, const QLocale &oldLocale)
+{
+    Q_D(QQuickSpinBox);
+    QQuickControl::localeChange(newLocale, oldLocale);
+    if (!d->textFromValue.isCallable())
+        d->setDisplayText(d->evaluateTextFromValue(d->value, newLocale));
+}
+
 QFont QQuickSpinBox::defaultFont() const
 {
     return QQuickControlPrivate::themeFont(QPlatformTheme::EditorFont);
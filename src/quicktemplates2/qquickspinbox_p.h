@@ -73,6 +73,8 @@ class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickSpinBox : public QQuickControl
     Q_PROPERTY(QQuickSpinButton *down READ down CONSTANT FINAL)
     Q_PROPERTY(Qt::InputMethodHints inputMethodHints READ inputMethodHints WRITE setInputMethodHints NOTIFY inputMethodHintsChanged FINAL REVISION 2)
     Q_PROPERTY(bool inputMethodComposing READ isInputMethodComposing NOTIFY inputMethodComposingChanged FINAL REVISION 2)
+    Q_PROPERTY(int decimals READ decimals WRITE setDecimals NOTIFY decimalsChanged FINAL REVISION 3)
+    Q_PROPERTY(QString displayText READ displayText NOTIFY displayTextChanged FINAL REVISION 3)
 
 public:
     explicit QQuickSpinBox(QQuickItem *parent = nullptr);
@@ -109,6 +111,11 @@ public:
 
     bool isInputMethodComposing() const;
 
+    int decimals() const;
+    void setDecimals(int decimals);
+
+    QString displayText() const;
+
 public Q_SLOTS:
     void increase();
     void decrease();
@@ -125,6 +132,8 @@ Q_SIGNALS:
     Q_REVISION(2) void valueModified();
     Q_REVISION(2) void inputMethodHintsChanged();
     Q_REVISION(2) void inputMethodComposingChanged();
+    Q_REVISION(3) void decimalsChanged();
+    Q_REVISION(3) void displayTextChanged();
 
 protected:
     void hoverEnterEvent(QHoverEvent *event) override;
@@ -147,6 +156,8 @@ protected:
     void itemChange(ItemChange change, const ItemChangeData &value) override;
     void contentItemChange(QQuickItem *newItem, QQuickItem *oldItem) override;
 
+    void localeChange(const QLocale &newLocale, const QLocale &oldLocale) override;
+
     QFont defaultFont() const override;
 
 #if QT_CONFIG(accessibility)
@@ -40,10 +40,13 @@
 #include "qquickitemdelegate_p_p.h"
 #include "qquickvelocitycalculator_p_p.h"
 
+#include <QtCore/qpointer.h>
 #include <QtGui/qstylehints.h>
 #include <QtGui/private/qguiapplication_p.h>
 #include <QtGui/qpa/qplatformtheme.h>
+#include <QtQml/qqmlengine.h>
 #include <QtQml/qqmlinfo.h>
+#include <QtQml/qqmlincubator.h>
 #include <QtQuick/private/qquickanimation_p.h>
 #include <QtQuick/private/qquicktransition_p.h>
 #include <QtQuick/private/qquicktransitionmanager_p_p.h>
@@ -130,6 +133,25 @@ private:
     QQuickSwipe *m_swipe;
 };
 
+// Incubates a swipe delegate item once the control is pressed, during the
+// idle time between frames, so that the drag doesn't have to create it.
+class QQuickSwipeIncubator : public QQmlIncubator
+{
+public:
+    QQuickSwipeIncubator(QQuickSwipeDelegate *control, IncubationMode mode);
+    ~QQuickSwipeIncubator();
+
+    QQuickItem *take();
+
+protected:
+    void setInitialState(QObject *object) override;
+    void statusChanged(Status status) override;
+
+private:
+    QQuickSwipeDelegate *m_control;
+    QPointer<QQuickItem> m_item;
+};
+
 class QQuickSwipePrivate : public QObjectPrivate
 {
     Q_DECLARE_PUBLIC(QQuickSwipe)
@@ -156,8 +178,11 @@ public:
     static QQuickSwipePrivate *get(QQuickSwipe *swipe);
 
     QQuickItem *createDelegateItem(QQmlComponent *component);
+    bool incubateDelegateItem(QQmlComponent *component, QScopedPointer<QQuickSwipeIncubator> &incubator);
+    void incubateDelegateItems();
+    bool adoptDelegateItem(QQuickItem *item, QScopedPointer<QQuickSwipeIncubator> &incubator, void (QQuickSwipe::*setItem)(QQuickItem *));
     QQuickItem *showRelevantItemForPosition(qreal position);
-    QQuickItem *createRelevantItemForDistance(qreal distance);
+    QQuickItem *relevantItemForDistance(qreal distance, bool *incubating);
     void reposition(PositionAnimation animationPolicy);
     void createLeftItem();
     void createBehindItem();
@@ -194,8 +219,59 @@ public:
     QQuickItem *rightItem;
     QQuickTransition *transition;
     QScopedPointer<QQuickSwipeTransitionManager> transitionManager;
+    QScopedPointer<QQuickSwipeIncubator> leftIncubator;
+    QScopedPointer<QQuickSwipeIncubator> behindIncubator;
+    QScopedPointer<QQuickSwipeIncubator> rightIncubator;
 };
 
+QQuickSwipeIncubator::QQuickSwipeIncubator(QQuickSwipeDelegate *control, IncubationMode mode)
+    : QQmlIncubator(mode),
+      m_control(control)
+{
+}
+
+QQuickSwipeIncubator::~QQuickSwipeIncubator()
+{
+    // an incubated item that was never taken into use
+    delete m_item.data();
+}
+
+QQuickItem *QQuickSwipeIncubator::take()
+{
+    if (isLoading())
+        forceCompletion();
+
+    QQuickItem *item = m_item.data();
+    m_item.clear();
+    if (item)
+        item->setVisible(true);
+    return item;
+}
+
+void QQuickSwipeIncubator::setInitialState(QObject *object)
+{
+    // Parent the item to the control, like createDelegateItem() does, so that
+    // bindings to the parent's size resolve while the item is incubating.
+    // It stays hidden until it's taken into use.
+    object->setParent(m_control);
+    if (QQuickItem *item = qobject_cast<QQuickItem *>(object)) {
+        item->setVisible(false);
+        item->setParentItem(m_control);
+    }
+}
+
+void QQuickSwipeIncubator::statusChanged(Status status)
+{
+    if (status == Error)
+        qmlWarning(m_control) << "Failed to create swipe item:" << errors();
+    if (status != Ready)
+        return;
+
+    m_item = qobject_cast<QQuickItem *>(object());
+    if (!m_item)
+        delete object();
+}
+
 QQuickSwipeTransitionManager::QQuickSwipeTransitionManager(QQuickSwipe *swipe)
     : m_swipe(swipe)
 {
@@ -247,6 +323,66 @@ QQuickItem *QQuickSwipePrivate::createDelegateItem(QQmlComponent *component)
     return item;
 }
 
+bool QQuickSwipePrivate::incubateDelegateItem(QQmlComponent *component, QScopedPointer<QQuickSwipeIncubator> &incubator)
+{
+    if (!component || !component->isReady() || incubator)
+        return false;
+
+    QQmlContext *creationContext = component->creationContext();
+    if (!creationContext)
+        creationContext = qmlContext(control);
+    if (!creationContext)
+        return false;
+
+    // Without an incubation controller, asynchronous incubation would never finish.
+    QQmlEngine *engine = component->engine();
+    const QQmlIncubator::IncubationMode mode = engine && engine->incubationController()
+            ? QQmlIncubator::Asynchronous : QQmlIncubator::Synchronous;
+
+    QQmlContext *context = new QQmlContext(creationContext, control);
+    context->setContextObject(control);
+    incubator.reset(new QQuickSwipeIncubator(control, mode));
+    component->create(*incubator, context);
+    return incubator->isLoading();
+}
+
+// The time given to incubating the swipe items on press, so that small
+// items are ready by the time the drag begins. Larger items finish
+// incubating between the frames that follow.
+static const int pressIncubationTime = 5;
+
+void QQuickSwipePrivate::incubateDelegateItems()
+{
+    bool incubating = false;
+    if (!leftItem)
+        incubating |= incubateDelegateItem(left, leftIncubator);
+    if (!behindItem)
+        incubating |= incubateDelegateItem(behind, behindIncubator);
+    if (!rightItem)
+        incubating |= incubateDelegateItem(right, rightIncubator);
+
+    if (incubating) {
+        QQmlEngine *engine = qmlEngine(control);
+        if (QQmlIncubationController *controller = engine ? engine->incubationController() : nullptr)
+            controller->incubateFor(pressIncubationTime);
+    }
+}
+
+// Takes an incubated item into use. Returns false if the item is still
+// incubating; the move handler never creates items, so it has to wait.
+bool QQuickSwipePrivate::adoptDelegateItem(QQuickItem *item, QScopedPointer<QQuickSwipeIncubator> &incubator, void (QQuickSwipe::*setItem)(QQuickItem *))
+{
+    if (item || !incubator)
+        return true;
+    if (incubator->isLoading())
+        return false;
+
+    Q_Q(QQuickSwipe);
+    (q->*setItem)(incubator->take());
+    incubator.reset();
+    return true;
+}
+
 QQuickItem *QQuickSwipePrivate::showRelevantItemForPosition(qreal position)
 {
     if (qFuzzyIsNull(position))
@@ -270,13 +406,13 @@ QQuickItem *QQuickSwipePrivate::showRelevantItemForPosition(qreal position)
     return nullptr;
 }
 
-QQuickItem *QQuickSwipePrivate::createRelevantItemForDistance(qreal distance)
+QQuickItem *QQuickSwipePrivate::relevantItemForDistance(qreal distance, bool *incubating)
 {
     if (qFuzzyIsNull(distance))
         return nullptr;
 
     if (behind) {
-        createBehindItem();
+        *incubating = !adoptDelegateItem(behindItem, behindIncubator, &QQuickSwipe::setBehindItem);
         return behindItem;
     }
 
@@ -295,7 +431,7 @@ QQuickItem *QQuickSwipePrivate::createRelevantItemForDistance(qreal distance)
         if ((distance < 0.0 && positionBeforePress == 0.0) /* a) */
             || (rightItem && positionBeforePress == -1.0 && distance < rightItem->width()) /* b) */
             || (leftItem && positionBeforePress == 1.0 && qAbs(distance) > leftItem->width())) /* c) */ {
-            createRightItem();
+            *incubating = !adoptDelegateItem(rightItem, rightIncubator, &QQuickSwipe::setRightItem);
             return rightItem;
         }
     }
@@ -304,7 +440,7 @@ QQuickItem *QQuickSwipePrivate::createRelevantItemForDistance(qreal distance)
         if ((distance > 0.0 && positionBeforePress == 0.0) /* a) */
             || (leftItem && positionBeforePress == 1.0 && qAbs(distance) < leftItem->width()) /* b) */
             || (rightItem && positionBeforePress == -1.0 && qAbs(distance) > rightItem->width())) /* c) */ {
-            createLeftItem();
+            *incubating = !adoptDelegateItem(leftItem, leftIncubator, &QQuickSwipe::setLeftItem);
             return leftItem;
         }
     }
@@ -337,7 +473,9 @@ void QQuickSwipePrivate::createLeftItem()
 {
     if (!leftItem) {
         Q_Q(QQuickSwipe);
-        q->setLeftItem(createDelegateItem(left));
+        QQuickItem *item = leftIncubator ? leftIncubator->take() : nullptr;
+        leftIncubator.reset();
+        q->setLeftItem(item ? item : createDelegateItem(left));
         if (!leftItem)
             qmlWarning(control) << "Failed to create left item:" << left->errors();
     }
@@ -347,7 +485,9 @@ void QQuickSwipePrivate::createBehindItem()
 {
     if (!behindItem) {
         Q_Q(QQuickSwipe);
-        q->setBehindItem(createDelegateItem(behind));
+        QQuickItem *item = behindIncubator ? behindIncubator->take() : nullptr;
+        behindIncubator.reset();
+        q->setBehindItem(item ? item : createDelegateItem(behind));
         if (!behindItem)
             qmlWarning(control) << "Failed to create behind item:" << behind->errors();
     }
@@ -357,7 +497,9 @@ void QQuickSwipePrivate::createRightItem()
 {
     if (!rightItem) {
         Q_Q(QQuickSwipe);
-        q->setRightItem(createDelegateItem(right));
+        QQuickItem *item = rightIncubator ? rightIncubator->take() : nullptr;
+        rightIncubator.reset();
+        q->setRightItem(item ? item : createDelegateItem(right));
         if (!rightItem)
             qmlWarning(control) << "Failed to create right item:" << right->errors();
     }
@@ -474,6 +616,8 @@ void QQuickSwipe::setLeft(QQmlComponent *left)
         d->leftItem = nullptr;
     }
 
+    d->leftIncubator.reset();
+
     d->control->setFiltersChildMouseEvents(d->hasDelegates());
 
     emit leftChanged();
@@ -508,6 +652,8 @@ void QQuickSwipe::setBehind(QQmlComponent *behind)
         d->behindItem = nullptr;
     }
 
+    d->behindIncubator.reset();
+
     d->control->setFiltersChildMouseEvents(d->hasDelegates());
 
     emit behindChanged();
@@ -542,6 +688,8 @@ void QQuickSwipe::setRight(QQmlComponent *right)
         d->rightItem = nullptr;
     }
 
+    d->rightIncubator.reset();
+
     d->control->setFiltersChildMouseEvents(d->hasDelegates());
 
     emit rightChanged();
@@ -737,6 +885,8 @@ bool QQuickSwipeDelegatePrivate::handleMousePressEvent(QQuickItem *item, QMouseE
         // so we correct it after calling the base class' mousePressEvent(), rather
         // than having to duplicate its code just so we can set the pressPoint.
         pressPoint = item->mapToItem(q, event->pos());
+        if (swipePrivate->enabled)
+            swipePrivate->velocityCalculator.startMeasuring(pressPoint, event->timestamp());
         return true;
     }
 
@@ -744,8 +894,10 @@ bool QQuickSwipeDelegatePrivate::handleMousePressEvent(QQuickItem *item, QMouseE
     // (the control can be clicked to e.g. close the swipe). Either way, we must begin measuring
     // mouse movement in case it turns into a swipe, in which case we grab the mouse.
     swipePrivate->positionBeforePress = swipePrivate->position;
-    swipePrivate->velocityCalculator.startMeasuring(event->pos(), event->timestamp());
     pressPoint = item->mapToItem(q, event->pos());
+    swipePrivate->velocityCalculator.startMeasuring(pressPoint, event->timestamp());
+    if (swipePrivate->enabled)
+        swipePrivate->incubateDelegateItems();
 
     // When a delegate uses the attached properties and signals, it declares that it wants mouse events.
     Attached *attached = attachedObject(item);
@@ -763,7 +915,7 @@ bool QQuickSwipeDelegatePrivate::handleMouseMoveEvent(QQuickItem *item, QMouseEv
 {
     Q_Q(QQuickSwipeDelegate);
 
-    if (holdTimer > 0) {
+    if (holdTimer.isActive()) {
         if (QLineF(pressPoint, event->localPos()).length() > QGuiApplication::styleHints()->startDragDistance())
             stopPressAndHold();
     }
@@ -786,7 +938,11 @@ bool QQuickSwipeDelegatePrivate::handleMouseMoveEvent(QQuickItem *item, QMouseEv
     if (item == q && !pressed)
         return false;
 
+    // The event position is in the coordinates of the item that received it,
+    // which changes from a child to the control when the mouse is grabbed.
     const QPointF mappedEventPos = item->mapToItem(q, event->pos());
+    swipePrivate->velocityCalculator.addSample(mappedEventPos, event->timestamp());
+
     const qreal distance = (mappedEventPos - pressPoint).x();
     if (!q->keepMouseGrab()) {
         // Taken from QQuickDrawerPrivate::grabMouse; see comments there.
@@ -817,9 +973,15 @@ bool QQuickSwipeDelegatePrivate::handleMouseMoveEvent(QQuickItem *item, QMouseEv
                     || (swipePrivate->positionBeforePress == -1.0 && distance >= 0.0)
                     || (swipePrivate->positionBeforePress == 1.0 && distance <= 0.0)))) {
 
-            // We must instantiate the items here so that we can calculate the
-            // position against the width of the relevant item.
-            QQuickItem *relevantItem = swipePrivate->createRelevantItemForDistance(distance);
+            // We need the relevant item to calculate the position against its width.
+            // It was incubated when the control was pressed, and if it's not ready yet,
+            // the drag catches up with the next move event after it is.
+            bool incubating = false;
+            QQuickItem *relevantItem = swipePrivate->relevantItemForDistance(distance, &incubating);
+            if (incubating) {
+                event->accept();
+                return true;
+            }
             // If there isn't any relevant item, the user may have swiped back to the 0 position,
             // or they swiped back to a position that is equal to positionBeforePress.
             const qreal normalizedDistance = relevantItem ? distance / relevantItem->width() : 0.0;
@@ -874,7 +1036,7 @@ bool QQuickSwipeDelegatePrivate::handleMouseReleaseEvent(QQuickItem *item, QMous
 {
     Q_Q(QQuickSwipeDelegate);
     QQuickSwipePrivate *swipePrivate = QQuickSwipePrivate::get(&swipe);
-    swipePrivate->velocityCalculator.stopMeasuring(event->pos(), event->timestamp());
+    swipePrivate->velocityCalculator.stopMeasuring(item->mapToItem(q, event->pos()), event->timestamp());
 
     const bool hadGrabbedMouse = q->keepMouseGrab();
     q->setKeepMouseGrab(false);
@@ -1192,6 +1354,7 @@ void QQuickSwipeDelegate::mousePressEvent(QMouseEvent *event)
 
     swipePrivate->positionBeforePress = swipePrivate->position;
     swipePrivate->velocityCalculator.startMeasuring(event->pos(), event->timestamp());
+    swipePrivate->incubateDelegateItems();
 }
 
 void QQuickSwipeDelegate::mouseMoveEvent(QMouseEvent *event)
@@ -103,23 +103,60 @@ public:
     void updateCurrentItem();
     void updateCurrentIndex();
     void updateLayout();
+    void updateFixedTabs();
+    void updateWidths();
+
+    // The implicit size and width of each tab is cached, so that a change in
+    // a single tab doesn't require querying all the tabs. The widths are summed
+    // up once per layout, and only if any of them changed. The implicit heights
+    // are counted by value, so that the maximum is known without a rescan.
+    struct Tab
+    {
+        qreal implicitWidth;
+        qreal implicitHeight;
+        qreal width;
+        bool resizable;
+    };
+
+    static Tab tabInfo(QQuickItem *item);
+    void addTab(QQuickItem *item);
+    void removeTab(QQuickItem *item);
+    void updateTab(QQuickItem *item);
+    void addImplicitHeight(qreal height);
+    void removeImplicitHeight(qreal height);
+    qreal maxImplicitHeight() const;
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff) override;
     void itemImplicitWidthChanged(QQuickItem *item) override;
     void itemImplicitHeightChanged(QQuickItem *item) override;
 
     bool updatingLayout;
+    bool layoutDirty;
+    bool widthsDirty;
     bool hasContentWidth;
     bool hasContentHeight;
+    int resizableCount;
+    qreal resizableWidth;
+    qreal reservedWidth;
+    qreal layoutItemWidth;
     qreal contentWidth;
     qreal contentHeight;
     QQuickTabBar::Position position;
+    QHash<QQuickItem *, Tab> tabs;
+    QVector<QQuickItem *> fixedTabs;
+    QMap<qreal, int> implicitHeights;
 };
 
 QQuickTabBarPrivate::QQuickTabBarPrivate()
     : updatingLayout(false),
+      layoutDirty(false),
+      widthsDirty(false),
       hasContentWidth(false),
       hasContentHeight(false),
+      resizableCount(0),
+      resizableWidth(0),
+      reservedWidth(0),
+      layoutItemWidth(-1),
       contentWidth(0),
       contentHeight(0),
       position(QQuickTabBar::Header)
@@ -149,41 +186,41 @@ void QQuickTabBarPrivate::updateLayout()
     if (count <= 0 || !contentItem)
         return;
 
-    qreal maxHeight = 0;
-    qreal totalWidth = 0;
-    qreal reservedWidth = 0;
-
-    QVector<QQuickItem *> resizableItems;
-    resizableItems.reserve(count);
-
-    for (int i = 0; i < count; ++i) {
-        QQuickItem *item = q->itemAt(i);
-        if (item) {
-            QQuickItemPrivate *p = QQuickItemPrivate::get(item);
-            if (!p->widthValid) {
-                resizableItems += item;
-                totalWidth += item->implicitWidth();
-            } else {
-                reservedWidth += item->width();
-                totalWidth += item->width();
-            }
-            maxHeight = qMax(maxHeight, item->implicitHeight());
-        }
-    }
+    updateFixedTabs();
+    if (widthsDirty)
+        updateWidths();
 
     const qreal totalSpacing = qMax(0, count - 1) * spacing;
-    totalWidth += totalSpacing;
-
-    if (!resizableItems.isEmpty()) {
-        const qreal itemWidth = (contentItem->width() - reservedWidth - totalSpacing) / resizableItems.count();
-
-        updatingLayout = true;
-        for (QQuickItem *item : qAsConst(resizableItems)) {
-            item->setWidth(itemWidth);
-            QQuickItemPrivate::get(item)->widthValid = false;
+    const qreal totalWidth = resizableWidth + reservedWidth + totalSpacing;
+    const qreal maxHeight = maxImplicitHeight();
+
+    if (resizableCount > 0) {
+        const qreal itemWidth = (contentItem->width() - reservedWidth - totalSpacing) / resizableCount;
+
+        // only touch the tabs if the width available for them, or the set of tabs, changed
+        if (layoutDirty || !qFuzzyCompare(itemWidth, layoutItemWidth)) {
+            updatingLayout = true;
+            for (int i = 0; i < count; ++i) {
+                QQuickItem *item = q->itemAt(i);
+                if (!item || !tabs.value(item).resizable)
+                    continue;
+                // an explicit width that happens to match the current width
+                // doesn't change the geometry, so it's only noticed here
+                if (QQuickItemPrivate::get(item)->widthValid) {
+                    updateTab(item);
+                    q->polish();
+                    continue;
+                }
+                if (!qFuzzyCompare(item->width(), itemWidth)) {
+                    item->setWidth(itemWidth);
+                    QQuickItemPrivate::get(item)->widthValid = false;
+                }
+            }
+            updatingLayout = false;
         }
-        updatingLayout = false;
+        layoutItemWidth = itemWidth;
     }
+    layoutDirty = false;
 
     bool contentWidthChange = false;
     if (!hasContentWidth && !qFuzzyCompare(contentWidth, totalWidth)) {
@@ -203,22 +240,140 @@ void QQuickTabBarPrivate::updateLayout()
         emit q->contentHeightChanged();
 }
 
-void QQuickTabBarPrivate::itemGeometryChanged(QQuickItem *, QQuickGeometryChange, const QRectF &)
+// Resetting the width of a tab that already has its implicit width doesn't
+// change its geometry, so there is no notification for a tab becoming
+// resizable again. Only the tabs that have an explicit width are checked.
+void QQuickTabBarPrivate::updateFixedTabs()
+{
+    // updateTab() removes the tabs that became resizable
+    for (int i = fixedTabs.count() - 1; i >= 0; --i) {
+        QQuickItem *item = fixedTabs.at(i);
+        if (!QQuickItemPrivate::get(item)->widthValid)
+            updateTab(item);
+    }
+}
+
+// The sums are recomputed from the cached widths rather than adjusted as
+// the tabs change, so that rounding errors don't accumulate over time.
+void QQuickTabBarPrivate::updateWidths()
+{
+    resizableCount = 0;
+    resizableWidth = 0;
+    reservedWidth = 0;
+    for (const Tab &tab : qAsConst(tabs)) {
+        if (tab.resizable) {
+            ++resizableCount;
+            resizableWidth += tab.implicitWidth;
+        } else {
+            reservedWidth += tab.width;
+        }
+    }
+    widthsDirty = false;
+}
+
+QQuickTabBarPrivate::Tab QQuickTabBarPrivate::tabInfo(QQuickItem *item)
+{
+    Tab tab;
+    tab.implicitWidth = item->implicitWidth();
+    tab.implicitHeight = item->implicitHeight();
+    tab.width = item->width();
+    tab.resizable = !QQuickItemPrivate::get(item)->widthValid;
+    return tab;
+}
+
+void QQuickTabBarPrivate::addTab(QQuickItem *item)
+{
+    const Tab tab = tabInfo(item);
+    tabs.insert(item, tab);
+    if (!tab.resizable)
+        fixedTabs.append(item);
+    addImplicitHeight(tab.implicitHeight);
+    widthsDirty = true;
+    layoutDirty = true;
+}
+
+void QQuickTabBarPrivate::removeTab(QQuickItem *item)
+{
+    auto it = tabs.find(item);
+    if (it == tabs.end())
+        return;
+
+    if (!it->resizable)
+        fixedTabs.removeOne(item);
+    removeImplicitHeight(it->implicitHeight);
+    tabs.erase(it);
+    widthsDirty = true;
+    layoutDirty = true;
+}
+
+void QQuickTabBarPrivate::updateTab(QQuickItem *item)
 {
-    if (!updatingLayout)
-        updateLayout();
+    auto it = tabs.find(item);
+    if (it == tabs.end())
+        return;
+
+    const Tab tab = tabInfo(item);
+    if (tab.resizable != it->resizable) {
+        if (tab.resizable)
+            fixedTabs.removeOne(item);
+        else
+            fixedTabs.append(item);
+        widthsDirty = true;
+        layoutDirty = true;
+    } else if (tab.resizable ? tab.implicitWidth != it->implicitWidth : tab.width != it->width) {
+        widthsDirty = true;
+    }
+
+    if (tab.implicitHeight != it->implicitHeight) {
+        removeImplicitHeight(it->implicitHeight);
+        addImplicitHeight(tab.implicitHeight);
+    }
+
+    *it = tab;
+}
+
+void QQuickTabBarPrivate::addImplicitHeight(qreal height)
+{
+    ++implicitHeights[height];
+}
+
+void QQuickTabBarPrivate::removeImplicitHeight(qreal height)
+{
+    auto it = implicitHeights.find(height);
+    if (it != implicitHeights.end() && --it.value() <= 0)
+        implicitHeights.erase(it);
+}
+
+qreal QQuickTabBarPrivate::maxImplicitHeight() const
+{
+    return implicitHeights.isEmpty() ? 0 : implicitHeights.lastKey();
 }
 
-void QQuickTabBarPrivate::itemImplicitWidthChanged(QQuickItem *)
+void QQuickTabBarPrivate::itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &)
 {
+    Q_Q(QQuickTabBar);
+    // the tabs are positioned by the content item; only their widths matter here
+    if (updatingLayout || !change.widthChange())
+        return;
+
+    updateTab(item);
+    q->polish();
+}
+
+void QQuickTabBarPrivate::itemImplicitWidthChanged(QQuickItem *item)
+{
+    Q_Q(QQuickTabBar);
+    updateTab(item);
     if (!updatingLayout && !hasContentWidth)
-        updateLayout();
+        q->polish();
 }
 
-void QQuickTabBarPrivate::itemImplicitHeightChanged(QQuickItem *)
+void QQuickTabBarPrivate::itemImplicitHeightChanged(QQuickItem *item)
 {
+    Q_Q(QQuickTabBar);
+    updateTab(item);
     if (!updatingLayout && !hasContentHeight)
-        updateLayout();
+        q->polish();
 }
 
 QQuickTabBar::QQuickTabBar(QQuickItem *parent)
@@ -359,9 +514,9 @@ void QQuickTabBar::componentComplete()
 
 void QQuickTabBar::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
 {
-    Q_D(QQuickTabBar);
     QQuickContainer::geometryChanged(newGeometry, oldGeometry);
-    d->updateLayout();
+    if (isComponentComplete() && !qFuzzyCompare(newGeometry.width(), oldGeometry.width()))
+        polish();
 }
 
 bool QQuickTabBar::isContent(QQuickItem *item) const
@@ -374,6 +529,7 @@ void QQuickTabBar::itemAdded(int index, QQuickItem *item)
     Q_D(QQuickTabBar);
     Q_UNUSED(index);
     QQuickItemPrivate::get(item)->setCulled(true); // QTBUG-55129
+    d->addTab(item);
     if (QQuickTabButton *button = qobject_cast<QQuickTabButton *>(item))
         QObjectPrivate::connect(button, &QQuickTabButton::checkedChanged, d, &QQuickTabBarPrivate::updateCurrentIndex);
     if (isComponentComplete())
@@ -384,6 +540,7 @@ void QQuickTabBar::itemRemoved(int index, QQuickItem *item)
 {
     Q_D(QQuickTabBar);
     Q_UNUSED(index);
+    d->removeTab(item);
     if (QQuickTabButton *button = qobject_cast<QQuickTabButton *>(item))
         QObjectPrivate::disconnect(button, &QQuickTabButton::checkedChanged, d, &QQuickTabBarPrivate::updateCurrentIndex);
     if (isComponentComplete())
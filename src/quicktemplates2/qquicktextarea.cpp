@@ -40,10 +40,13 @@
 #include "qquickcontrol_p_p.h"
 #include "qquickscrollview_p.h"
 
+#include <QtCore/qmath.h>
+#include <QtGui/qfontmetrics.h>
 #include <QtQml/qqmlinfo.h>
 #include <QtQuick/private/qquickitem_p.h>
 #include <QtQuick/private/qquickclipnode_p.h>
 #include <QtQuick/private/qquickflickable_p.h>
+#include <QtQuick/private/qquicktext_p.h>
 
 #if QT_CONFIG(accessibility)
 #include <QtQuick/private/qquickaccessibleattached_p.h>
@@ -137,9 +140,15 @@ QQuickTextAreaPrivate::QQuickTextAreaPrivate()
       explicitHoverEnabled(false),
 #endif
       background(nullptr),
+      placeholderItemEnabled(false),
+      placeholderItem(nullptr),
       focusReason(Qt::OtherFocusReason),
       accessibleAttached(nullptr),
-      flickable(nullptr)
+      flickable(nullptr),
+      followTail(false),
+      pendingCursorVisible(false),
+      pendingFlickableControl(false),
+      pendingFlickableContent(false)
 {
 #if QT_CONFIG(accessibility)
     QAccessible::installActivationObserver(this);
@@ -230,15 +239,15 @@ void QQuickTextAreaPrivate::attachFlickable(QQuickFlickable *item)
     if (background)
         background->setParentItem(flickable);
 
-    QObjectPrivate::connect(q, &QQuickTextArea::contentSizeChanged, this, &QQuickTextAreaPrivate::resizeFlickableContent);
-    QObjectPrivate::connect(q, &QQuickTextEdit::cursorRectangleChanged, this, &QQuickTextAreaPrivate::ensureCursorVisible);
+    QObjectPrivate::connect(q, &QQuickTextArea::contentSizeChanged, this, &QQuickTextAreaPrivate::scheduleResizeFlickableContent);
+    QObjectPrivate::connect(q, &QQuickTextEdit::cursorRectangleChanged, this, &QQuickTextAreaPrivate::scheduleEnsureCursorVisible);
 
     QObject::connect(flickable, &QQuickFlickable::contentXChanged, q, &QQuickItem::update);
     QObject::connect(flickable, &QQuickFlickable::contentYChanged, q, &QQuickItem::update);
 
     QQuickItemPrivate::get(flickable)->updateOrAddGeometryChangeListener(this, QQuickGeometryChange::Size);
-    QObjectPrivate::connect(flickable, &QQuickFlickable::contentWidthChanged, this, &QQuickTextAreaPrivate::resizeFlickableControl);
-    QObjectPrivate::connect(flickable, &QQuickFlickable::contentHeightChanged, this, &QQuickTextAreaPrivate::resizeFlickableControl);
+    QObjectPrivate::connect(flickable, &QQuickFlickable::contentWidthChanged, this, &QQuickTextAreaPrivate::scheduleResizeFlickableControl);
+    QObjectPrivate::connect(flickable, &QQuickFlickable::contentHeightChanged, this, &QQuickTextAreaPrivate::scheduleResizeFlickableControl);
 
     resizeFlickableControl();
 }
@@ -250,17 +259,20 @@ void QQuickTextAreaPrivate::detachFlickable()
     if (background && background->parentItem() == flickable)
         background->setParentItem(q);
 
-    QObjectPrivate::disconnect(q, &QQuickTextArea::contentSizeChanged, this, &QQuickTextAreaPrivate::resizeFlickableContent);
-    QObjectPrivate::disconnect(q, &QQuickTextEdit::cursorRectangleChanged, this, &QQuickTextAreaPrivate::ensureCursorVisible);
+    QObjectPrivate::disconnect(q, &QQuickTextArea::contentSizeChanged, this, &QQuickTextAreaPrivate::scheduleResizeFlickableContent);
+    QObjectPrivate::disconnect(q, &QQuickTextEdit::cursorRectangleChanged, this, &QQuickTextAreaPrivate::scheduleEnsureCursorVisible);
 
     QObject::disconnect(flickable, &QQuickFlickable::contentXChanged, q, &QQuickItem::update);
     QObject::disconnect(flickable, &QQuickFlickable::contentYChanged, q, &QQuickItem::update);
 
     QQuickItemPrivate::get(flickable)->updateOrRemoveGeometryChangeListener(this, QQuickGeometryChange::Size);
-    QObjectPrivate::disconnect(flickable, &QQuickFlickable::contentWidthChanged, this, &QQuickTextAreaPrivate::resizeFlickableControl);
-    QObjectPrivate::disconnect(flickable, &QQuickFlickable::contentHeightChanged, this, &QQuickTextAreaPrivate::resizeFlickableControl);
+    QObjectPrivate::disconnect(flickable, &QQuickFlickable::contentWidthChanged, this, &QQuickTextAreaPrivate::scheduleResizeFlickableControl);
+    QObjectPrivate::disconnect(flickable, &QQuickFlickable::contentHeightChanged, this, &QQuickTextAreaPrivate::scheduleResizeFlickableControl);
 
     flickable = nullptr;
+    pendingCursorVisible = false;
+    pendingFlickableControl = false;
+    pendingFlickableContent = false;
 }
 
 void QQuickTextAreaPrivate::ensureCursorVisible()
@@ -323,13 +335,75 @@ void QQuickTextAreaPrivate::resizeFlickableContent()
     flickable->setContentHeight(q->contentHeight() + q->topPadding() + q->bottomPadding());
 }
 
+void QQuickTextAreaPrivate::scrollToTail()
+{
+    if (!flickable)
+        return;
+
+    flickable->setContentY(qMax(flickable->originY(), flickable->originY() + flickable->contentHeight() - flickable->height()));
+}
+
+// Appending text, resizing the flickable and moving the cursor would each
+// resize the flickable content or the control, which in turn causes the
+// other to be resized. The flickable is synchronized once per frame instead.
+void QQuickTextAreaPrivate::scheduleEnsureCursorVisible()
+{
+    Q_Q(QQuickTextArea);
+    if (followTail)
+        return;
+
+    pendingCursorVisible = true;
+    q->polish();
+}
+
+void QQuickTextAreaPrivate::scheduleResizeFlickableControl()
+{
+    Q_Q(QQuickTextArea);
+    pendingFlickableControl = true;
+    q->polish();
+}
+
+void QQuickTextAreaPrivate::scheduleResizeFlickableContent()
+{
+    Q_Q(QQuickTextArea);
+    pendingFlickableContent = true;
+    q->polish();
+}
+
+void QQuickTextAreaPrivate::syncFlickable()
+{
+    if (!flickable)
+        return;
+
+    // the flickable content has not been resized yet, so this tells
+    // whether the view was following the end of the text before it changed
+    const bool atTail = followTail && pendingFlickableContent
+            && flickable->contentY() >= flickable->originY() + flickable->contentHeight() - flickable->height() - 1;
+
+    if (pendingFlickableContent) {
+        pendingFlickableContent = false;
+        resizeFlickableContent();
+    }
+    if (pendingFlickableControl) {
+        pendingFlickableControl = false;
+        resizeFlickableControl();
+    }
+
+    if (atTail) {
+        scrollToTail();
+    } else if (pendingCursorVisible) {
+        pendingCursorVisible = false;
+        ensureCursorVisible();
+    }
+}
+
 void QQuickTextAreaPrivate::itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff)
 {
     Q_UNUSED(item);
     Q_UNUSED(change);
     Q_UNUSED(diff);
 
-    resizeFlickableControl();
+    scheduleResizeFlickableControl();
 }
 
 qreal QQuickTextAreaPrivate::getImplicitWidth() const
@@ -368,6 +442,125 @@ void QQuickTextAreaPrivate::readOnlyChanged(bool isReadOnly)
 #endif
 }
 
+/*
+    The placeholder item is created the first time it would be visible. The
+    text area is only watched for changes that affect the placeholder while
+    there is a placeholder text to show.
+*/
+void QQuickTextAreaPrivate::watchPlaceholder()
+{
+    Q_Q(QQuickTextArea);
+    const bool watch = placeholderItemEnabled && !placeholder.isEmpty();
+    if (watch == !placeholderConnections.isEmpty())
+        return;
+
+    if (!watch) {
+        for (const QMetaObject::Connection &connection : qAsConst(placeholderConnections))
+            QObject::disconnect(connection);
+        placeholderConnections.clear();
+        return;
+    }
+
+    placeholderConnections.reserve(13);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextEdit::textChanged, this, &QQuickTextAreaPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextEdit::preeditTextChanged, this, &QQuickTextAreaPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickItem::activeFocusChanged, this, &QQuickTextAreaPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextEdit::colorChanged, this, &QQuickTextAreaPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextEdit::fontChanged, this, &QQuickTextAreaPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextEdit::wrapModeChanged, this, &QQuickTextAreaPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextEdit::verticalAlignmentChanged, this, &QQuickTextAreaPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextEdit::horizontalAlignmentChanged, this, &QQuickTextAreaPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextEdit::effectiveHorizontalAlignmentChanged, this, &QQuickTextAreaPrivate::updatePlaceholderAlignment);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextEdit::topPaddingChanged, this, &QQuickTextAreaPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextEdit::leftPaddingChanged, this, &QQuickTextAreaPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextEdit::rightPaddingChanged, this, &QQuickTextAreaPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextEdit::bottomPaddingChanged, this, &QQuickTextAreaPrivate::updatePlaceholder);
+}
+
+void QQuickTextAreaPrivate::updatePlaceholder()
+{
+    Q_Q(QQuickTextArea);
+    if (!q->isComponentComplete())
+        return;
+
+    const bool visible = placeholderItemEnabled && !placeholder.isEmpty() && !q->length() && q->preeditText().isEmpty()
+            && (!q->hasActiveFocus() || q->hAlign() != QQuickTextEdit::AlignHCenter);
+    if (!visible) {
+        if (placeholderItem)
+            placeholderItem->setVisible(false);
+        return;
+    }
+
+    if (!placeholderItem) {
+        placeholderItem = new QQuickText(q);
+        placeholderItem->setElideMode(QQuickText::ElideRight);
+    }
+
+    placeholderItem->setText(placeholder);
+    placeholderItem->setFont(q->font());
+    placeholderItem->setColor(placeholderColor.isValid() ? placeholderColor : q->color());
+    placeholderItem->setRenderType(static_cast<QQuickText::RenderType>(q->renderType()));
+    placeholderItem->setWrapMode(static_cast<QQuickText::WrapMode>(wrapMode));
+    placeholderItem->setVAlign(static_cast<QQuickText::VAlignment>(q->vAlign()));
+    placeholderItem->setPosition(QPointF(q->leftPadding(), q->topPadding()));
+    placeholderItem->setSize(QSizeF(q->width() - q->leftPadding() - q->rightPadding(),
+                                    q->height() - q->topPadding() - q->bottomPadding()));
+    placeholderItem->setVisible(true);
+    updatePlaceholderAlignment();
+}
+
+void QQuickTextAreaPrivate::updatePlaceholderAlignment()
+{
+    Q_Q(QQuickTextArea);
+    if (!placeholderItem || !placeholderItem->isVisible())
+        return;
+
+    if (hAlignImplicit)
+        placeholderItem->resetHAlign();
+    else
+        placeholderItem->setHAlign(static_cast<QQuickText::HAlignment>(q->hAlign()));
+}
+
+static int placeholderTextFlags(QQuickTextEdit::WrapMode wrapMode)
+{
+    switch (wrapMode) {
+    case QQuickTextEdit::NoWrap:
+        return 0;
+    case QQuickTextEdit::WrapAnywhere:
+        return Qt::TextWrapAnywhere;
+    default:
+        return Qt::TextWordWrap;
+    }
+}
+
+// The placeholder text is measured with the font metrics, without laying it
+// out in a text item. When the text area wraps, the placeholder text wraps
+// within the width available to the text.
+void QQuickTextAreaPrivate::updateImplicitPlaceholderSize()
+{
+    Q_Q(QQuickTextArea);
+    const QFontMetricsF fm(q->font());
+    QSizeF size(0, fm.height());
+    if (!placeholder.isEmpty()) {
+        const int flags = placeholderTextFlags(wrapMode);
+        const qreal availableWidth = q->width() - q->leftPadding() - q->rightPadding();
+        QRectF rect;
+        if (flags != 0 && availableWidth > 0)
+            rect.setWidth(availableWidth);
+        const QRectF bounds = fm.boundingRect(rect, flags, placeholder);
+        size = QSizeF(qCeil(bounds.width()), qCeil(bounds.height()));
+    }
+    if (size == implicitPlaceholderSize)
+        return;
+
+    const QSizeF oldSize = implicitPlaceholderSize;
+    implicitPlaceholderSize = size;
+    if (!qFuzzyCompare(size.width(), oldSize.width()))
+        emit q->implicitPlaceholderWidthChanged();
+    if (!qFuzzyCompare(size.height(), oldSize.height()))
+        emit q->implicitPlaceholderHeightChanged();
+}
+
 #if QT_CONFIG(accessibility)
 void QQuickTextAreaPrivate::accessibilityActiveChanged(bool active)
 {
@@ -404,6 +597,10 @@ QQuickTextArea::QQuickTextArea(QQuickItem *parent)
 #endif
     QObjectPrivate::connect(this, &QQuickTextEdit::readOnlyChanged,
                             d, &QQuickTextAreaPrivate::readOnlyChanged);
+    QObjectPrivate::connect(this, &QQuickTextEdit::fontChanged, d, &QQuickTextAreaPrivate::updateImplicitPlaceholderSize);
+    QObjectPrivate::connect(this, &QQuickTextEdit::wrapModeChanged, d, &QQuickTextAreaPrivate::updateImplicitPlaceholderSize);
+    QObjectPrivate::connect(this, &QQuickTextEdit::leftPaddingChanged, d, &QQuickTextAreaPrivate::updateImplicitPlaceholderSize);
+    QObjectPrivate::connect(this, &QQuickTextEdit::rightPaddingChanged, d, &QQuickTextAreaPrivate::updateImplicitPlaceholderSize);
 }
 
 QQuickTextAreaAttached *QQuickTextArea::qmlAttachedProperties(QObject *object)
@@ -482,6 +679,9 @@ void QQuickTextArea::setPlaceholderText(const QString &text)
     if (d->accessibleAttached)
         d->accessibleAttached->setDescription(text);
 #endif
+    d->updateImplicitPlaceholderSize();
+    d->watchPlaceholder();
+    d->updatePlaceholder();
     emit placeholderTextChanged();
 }
 
@@ -590,6 +790,141 @@ bool QQuickTextArea::contains(const QPointF &point) const
     return QQuickTextEdit::contains(point);
 }
 
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty color QtQuick.Controls::TextArea::placeholderTextColor
+
+    This property holds the color of \l placeholderText. By default, the
+    placeholder text is drawn with the same color as the text.
+
+    \sa placeholderText
+*/
+QColor QQuickTextArea::placeholderTextColor() const
+{
+    Q_D(const QQuickTextArea);
+    return d->placeholderColor;
+}
+
+void QQuickTextArea::setPlaceholderTextColor(const QColor &color)
+{
+    Q_D(QQuickTextArea);
+    if (d->placeholderColor == color)
+        return;
+
+    d->placeholderColor = color;
+    d->updatePlaceholder();
+    emit placeholderTextColorChanged();
+}
+
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty real QtQuick.Controls::TextArea::implicitPlaceholderWidth
+    \readonly
+
+    This property holds the implicit width of \l placeholderText. It is
+    calculated from the font metrics, without laying out the placeholder text,
+    and is \c 0 when there is no placeholder text. When the text area wraps,
+    the placeholder text wraps within the width available to the text.
+
+    \sa implicitPlaceholderHeight
+*/
+qreal QQuickTextArea::implicitPlaceholderWidth() const
+{
+    Q_D(const QQuickTextArea);
+    return d->implicitPlaceholderSize.width();
+}
+
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty real QtQuick.Controls::TextArea::implicitPlaceholderHeight
+    \readonly
+
+    This property holds the implicit height of \l placeholderText. It is
+    calculated from the font metrics, without laying out the placeholder text.
+
+    \sa implicitPlaceholderWidth
+*/
+qreal QQuickTextArea::implicitPlaceholderHeight() const
+{
+    Q_D(const QQuickTextArea);
+    return d->implicitPlaceholderSize.height();
+}
+
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty bool QtQuick.Controls::TextArea::placeholderItemEnabled
+
+    This property holds whether the text area draws \l placeholderText
+    itself. The placeholder item is created only when it is visible, that is,
+    when \l placeholderText is set and the text area is empty.
+
+    The default value is \c false, so that custom styles that provide a
+    placeholder item of their own do not draw the placeholder text twice.
+    The built-in styles set this property to \c true.
+
+    \sa placeholderText, placeholderTextColor
+*/
+bool QQuickTextArea::isPlaceholderItemEnabled() const
+{
+    Q_D(const QQuickTextArea);
+    return d->placeholderItemEnabled;
+}
+
+void QQuickTextArea::setPlaceholderItemEnabled(bool enabled)
+{
+    Q_D(QQuickTextArea);
+    if (d->placeholderItemEnabled == enabled)
+        return;
+
+    d->placeholderItemEnabled = enabled;
+    d->watchPlaceholder();
+    d->updatePlaceholder();
+    emit placeholderItemEnabledChanged();
+}
+
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty bool QtQuick.Controls::TextArea::followTail
+
+    This property holds whether a text area attached to a \l Flickable keeps
+    the end of the text visible as text is appended. The default value is
+    \c false.
+
+    When enabled, the flickable is scrolled to the end of the text whenever
+    the text changes while the end of the text is visible. Scrolling away
+    from the end stops following the text until the end is scrolled back
+    into view. The cursor is not kept visible in this mode, which makes it
+    suitable for read-only text areas, such as logs, that have text
+    appended frequently.
+
+    \code
+    ScrollView {
+        TextArea {
+            readOnly: true
+            followTail: true
+        }
+    }
+    \endcode
+
+    \sa {TextArea::flickable}{TextArea.flickable}
+*/
+bool QQuickTextArea::followTail() const
+{
+    Q_D(const QQuickTextArea);
+    return d->followTail;
+}
+
+void QQuickTextArea::setFollowTail(bool follow)
+{
+    Q_D(QQuickTextArea);
+    if (d->followTail == follow)
+        return;
+
+    d->followTail = follow;
+    d->pendingCursorVisible = false;
+    emit followTailChanged();
+}
+
 void QQuickTextArea::classBegin()
 {
     Q_D(QQuickTextArea);
@@ -605,6 +940,8 @@ void QQuickTextArea::componentComplete()
     if (!d->explicitHoverEnabled)
         setAcceptHoverEvents(QQuickControlPrivate::calcHoverEnabled(d->parentItem));
 #endif
+    d->updateImplicitPlaceholderSize();
+    d->updatePlaceholder();
 #if QT_CONFIG(accessibility)
     if (!d->accessibleAttached && QAccessible::isActive())
         d->accessibilityActiveChanged(true);
@@ -635,6 +972,17 @@ void QQuickTextArea::geometryChanged(const QRectF &newGeometry, const QRectF &ol
     Q_D(QQuickTextArea);
     QQuickTextEdit::geometryChanged(newGeometry, oldGeometry);
     d->resizeBackground();
+    if (d->wrapMode != QQuickTextEdit::NoWrap && !qFuzzyCompare(newGeometry.width(), oldGeometry.width()))
+        d->updateImplicitPlaceholderSize();
+    if (d->placeholderItem && d->placeholderItem->isVisible())
+        d->updatePlaceholder();
+}
+
+void QQuickTextArea::updatePolish()
+{
+    Q_D(QQuickTextArea);
+    QQuickTextEdit::updatePolish();
+    d->syncFlickable();
 }
 
 QSGNode *QQuickTextArea::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
@@ -700,8 +1048,9 @@ void QQuickTextArea::mousePressEvent(QMouseEvent *event)
     Q_D(QQuickTextArea);
     d->pressHandler.mousePressEvent(event);
     if (d->pressHandler.isActive()) {
-        if (d->pressHandler.delayedMousePressEvent) {
-            QQuickTextEdit::mousePressEvent(d->pressHandler.delayedMousePressEvent);
+        if (d->pressHandler.hasDelayedMousePressEvent) {
+            QMouseEvent delayedEvent = d->pressHandler.delayedMousePressEvent();
+            QQuickTextEdit::mousePressEvent(&delayedEvent);
             d->pressHandler.clearDelayedMouseEvent();
         }
         // Calling the base class implementation will result in QQuickTextControl's
@@ -718,8 +1067,9 @@ void QQuickTextArea::mouseMoveEvent(QMouseEvent *event)
     Q_D(QQuickTextArea);
     d->pressHandler.mouseMoveEvent(event);
     if (d->pressHandler.isActive()) {
-        if (d->pressHandler.delayedMousePressEvent) {
-            QQuickTextEdit::mousePressEvent(d->pressHandler.delayedMousePressEvent);
+        if (d->pressHandler.hasDelayedMousePressEvent) {
+            QMouseEvent delayedEvent = d->pressHandler.delayedMousePressEvent();
+            QQuickTextEdit::mousePressEvent(&delayedEvent);
             d->pressHandler.clearDelayedMouseEvent();
         }
         QQuickTextEdit::mouseMoveEvent(event);
@@ -731,8 +1081,9 @@ void QQuickTextArea::mouseReleaseEvent(QMouseEvent *event)
     Q_D(QQuickTextArea);
     d->pressHandler.mouseReleaseEvent(event);
     if (d->pressHandler.isActive()) {
-        if (d->pressHandler.delayedMousePressEvent) {
-            QQuickTextEdit::mousePressEvent(d->pressHandler.delayedMousePressEvent);
+        if (d->pressHandler.hasDelayedMousePressEvent) {
+            QMouseEvent delayedEvent = d->pressHandler.delayedMousePressEvent();
+            QQuickTextEdit::mousePressEvent(&delayedEvent);
             d->pressHandler.clearDelayedMouseEvent();
         }
         QQuickTextEdit::mouseReleaseEvent(event);
@@ -742,8 +1093,9 @@ void QQuickTextArea::mouseReleaseEvent(QMouseEvent *event)
 void QQuickTextArea::mouseDoubleClickEvent(QMouseEvent *event)
 {
     Q_D(QQuickTextArea);
-    if (d->pressHandler.delayedMousePressEvent) {
-        QQuickTextEdit::mousePressEvent(d->pressHandler.delayedMousePressEvent);
+    if (d->pressHandler.hasDelayedMousePressEvent) {
+        QMouseEvent delayedEvent = d->pressHandler.delayedMousePressEvent();
+        QQuickTextEdit::mousePressEvent(&delayedEvent);
         d->pressHandler.clearDelayedMouseEvent();
     }
     QQuickTextEdit::mouseDoubleClickEvent(event);
@@ -69,6 +69,11 @@ class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickTextArea : public QQuickTextEdit
     Q_PROPERTY(Qt::FocusReason focusReason READ focusReason WRITE setFocusReason NOTIFY focusReasonChanged FINAL)
     Q_PROPERTY(bool hovered READ isHovered NOTIFY hoveredChanged FINAL REVISION 1)
     Q_PROPERTY(bool hoverEnabled READ isHoverEnabled WRITE setHoverEnabled RESET resetHoverEnabled NOTIFY hoverEnabledChanged FINAL REVISION 1)
+    Q_PROPERTY(QColor placeholderTextColor READ placeholderTextColor WRITE setPlaceholderTextColor NOTIFY placeholderTextColorChanged FINAL REVISION 3)
+    Q_PROPERTY(qreal implicitPlaceholderWidth READ implicitPlaceholderWidth NOTIFY implicitPlaceholderWidthChanged FINAL REVISION 3)
+    Q_PROPERTY(qreal implicitPlaceholderHeight READ implicitPlaceholderHeight NOTIFY implicitPlaceholderHeightChanged FINAL REVISION 3)
+    Q_PROPERTY(bool placeholderItemEnabled READ isPlaceholderItemEnabled WRITE setPlaceholderItemEnabled NOTIFY placeholderItemEnabledChanged FINAL REVISION 3)
+    Q_PROPERTY(bool followTail READ followTail WRITE setFollowTail NOTIFY followTailChanged FINAL REVISION 3)
 
 public:
     explicit QQuickTextArea(QQuickItem *parent = nullptr);
@@ -94,6 +99,18 @@ public:
     void setHoverEnabled(bool enabled);
     void resetHoverEnabled();
 
+    QColor placeholderTextColor() const;
+    void setPlaceholderTextColor(const QColor &color);
+
+    qreal implicitPlaceholderWidth() const;
+    qreal implicitPlaceholderHeight() const;
+
+    bool isPlaceholderItemEnabled() const;
+    void setPlaceholderItemEnabled(bool enabled);
+
+    bool followTail() const;
+    void setFollowTail(bool follow);
+
     bool contains(const QPointF &point) const override;
 
 Q_SIGNALS:
@@ -108,6 +125,11 @@ Q_SIGNALS:
     void pressAndHold(QQuickMouseEvent *event);
     Q_REVISION(1) void pressed(QQuickMouseEvent *event);
     Q_REVISION(1) void released(QQuickMouseEvent *event);
+    Q_REVISION(3) void placeholderTextColorChanged();
+    Q_REVISION(3) void implicitPlaceholderWidthChanged();
+    Q_REVISION(3) void implicitPlaceholderHeightChanged();
+    Q_REVISION(3) void placeholderItemEnabledChanged();
+    Q_REVISION(3) void followTailChanged();
 
 protected:
     void classBegin() override;
@@ -115,6 +137,7 @@ protected:
 
     void itemChange(ItemChange change, const ItemChangeData &value) override;
     void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+    void updatePolish() override;
     QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data) override;
 
     void focusInEvent(QFocusEvent *event) override;
@@ -92,6 +92,12 @@ public:
     void ensureCursorVisible();
     void resizeFlickableControl();
     void resizeFlickableContent();
+    void scrollToTail();
+
+    void scheduleEnsureCursorVisible();
+    void scheduleResizeFlickableControl();
+    void scheduleResizeFlickableContent();
+    void syncFlickable();
 
     void itemGeometryChanged(QQuickItem *item, QQuickGeometryChange change, const QRectF &diff) override;
 
@@ -103,6 +109,11 @@ public:
 
     void readOnlyChanged(bool isReadOnly);
 
+    void watchPlaceholder();
+    void updatePlaceholder();
+    void updatePlaceholderAlignment();
+    void updateImplicitPlaceholderSize();
+
 #if QT_CONFIG(accessibility)
     void accessibilityActiveChanged(bool active) override;
     QAccessible::Role accessibleRole() const override;
@@ -115,10 +126,19 @@ public:
     QFont font;
     QQuickItem *background;
     QString placeholder;
+    QColor placeholderColor;
+    QSizeF implicitPlaceholderSize;
+    bool placeholderItemEnabled;
+    QQuickText *placeholderItem;
+    QVector<QMetaObject::Connection> placeholderConnections;
     Qt::FocusReason focusReason;
     QQuickPressHandler pressHandler;
     QQuickAccessibleAttached *accessibleAttached;
     QQuickFlickable *flickable;
+    bool followTail;
+    bool pendingCursorVisible;
+    bool pendingFlickableControl;
+    bool pendingFlickableContent;
 };
 
 QT_END_NAMESPACE
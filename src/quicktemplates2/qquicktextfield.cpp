@@ -39,7 +39,10 @@
 #include "qquickcontrol_p.h"
 #include "qquickcontrol_p_p.h"
 
+#include <QtCore/qmath.h>
+#include <QtGui/qfontmetrics.h>
 #include <QtQuick/private/qquickitem_p.h>
+#include <QtQuick/private/qquicktext_p.h>
 #include <QtQuick/private/qquicktextinput_p.h>
 #include <QtQuick/private/qquickclipnode_p.h>
 
@@ -118,6 +121,8 @@ QQuickTextFieldPrivate::QQuickTextFieldPrivate()
       explicitHoverEnabled(false),
 #endif
       background(nullptr),
+      placeholderItemEnabled(false),
+      placeholderItem(nullptr),
       focusReason(Qt::OtherFocusReason),
       accessibleAttached(nullptr)
 {
@@ -149,6 +154,104 @@ void QQuickTextFieldPrivate::resizeBackground()
     }
 }
 
+/*
+    The placeholder item is created the first time it would be visible. The
+    text field is only watched for changes that affect the placeholder while
+    there is a placeholder text to show, so that fields without a placeholder
+    text pay nothing for it.
+*/
+void QQuickTextFieldPrivate::watchPlaceholder()
+{
+    Q_Q(QQuickTextField);
+    const bool watch = placeholderItemEnabled && !placeholder.isEmpty();
+    if (watch == !placeholderConnections.isEmpty())
+        return;
+
+    if (!watch) {
+        for (const QMetaObject::Connection &connection : qAsConst(placeholderConnections))
+            QObject::disconnect(connection);
+        placeholderConnections.clear();
+        return;
+    }
+
+    placeholderConnections.reserve(12);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextInput::textChanged, this, &QQuickTextFieldPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextInput::preeditTextChanged, this, &QQuickTextFieldPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickItem::activeFocusChanged, this, &QQuickTextFieldPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextInput::colorChanged, this, &QQuickTextFieldPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextInput::fontChanged, this, &QQuickTextFieldPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextInput::verticalAlignmentChanged, this, &QQuickTextFieldPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextInput::horizontalAlignmentChanged, this, &QQuickTextFieldPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextInput::effectiveHorizontalAlignmentChanged, this, &QQuickTextFieldPrivate::updatePlaceholderAlignment);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextInput::topPaddingChanged, this, &QQuickTextFieldPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextInput::leftPaddingChanged, this, &QQuickTextFieldPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextInput::rightPaddingChanged, this, &QQuickTextFieldPrivate::updatePlaceholder);
+    placeholderConnections += QObjectPrivate::connect(q, &QQuickTextInput::bottomPaddingChanged, this, &QQuickTextFieldPrivate::updatePlaceholder);
+}
+
+void QQuickTextFieldPrivate::updatePlaceholder()
+{
+    Q_Q(QQuickTextField);
+    if (!q->isComponentComplete())
+        return;
+
+    const bool visible = placeholderItemEnabled && !placeholder.isEmpty() && !q->length() && q->preeditText().isEmpty()
+            && (!q->hasActiveFocus() || q->hAlign() != QQuickTextInput::AlignHCenter);
+    if (!visible) {
+        if (placeholderItem)
+            placeholderItem->setVisible(false);
+        return;
+    }
+
+    if (!placeholderItem) {
+        placeholderItem = new QQuickText(q);
+        placeholderItem->setElideMode(QQuickText::ElideRight);
+    }
+
+    placeholderItem->setText(placeholder);
+    placeholderItem->setFont(q->font());
+    placeholderItem->setColor(placeholderColor.isValid() ? placeholderColor : q->color());
+    placeholderItem->setRenderType(static_cast<QQuickText::RenderType>(q->renderType()));
+    placeholderItem->setVAlign(static_cast<QQuickText::VAlignment>(q->vAlign()));
+    placeholderItem->setPosition(QPointF(q->leftPadding(), q->topPadding()));
+    placeholderItem->setSize(QSizeF(q->width() - q->leftPadding() - q->rightPadding(),
+                                    q->height() - q->topPadding() - q->bottomPadding()));
+    placeholderItem->setVisible(true);
+    updatePlaceholderAlignment();
+}
+
+void QQuickTextFieldPrivate::updatePlaceholderAlignment()
+{
+    Q_Q(QQuickTextField);
+    if (!placeholderItem || !placeholderItem->isVisible())
+        return;
+
+    if (hAlignImplicit)
+        placeholderItem->resetHAlign();
+    else
+        placeholderItem->setHAlign(static_cast<QQuickText::HAlignment>(q->hAlign()));
+}
+
+void QQuickTextFieldPrivate::updateImplicitPlaceholderSize()
+{
+    Q_Q(QQuickTextField);
+    const QFontMetricsF fm(q->font());
+    QSizeF size(0, fm.height());
+    if (!placeholder.isEmpty()) {
+        const QRectF bounds = fm.boundingRect(QRectF(), 0, placeholder);
+        size = QSizeF(qCeil(bounds.width()), qCeil(bounds.height()));
+    }
+    if (size == implicitPlaceholderSize)
+        return;
+
+    const QSizeF oldSize = implicitPlaceholderSize;
+    implicitPlaceholderSize = size;
+    if (!qFuzzyCompare(size.width(), oldSize.width()))
+        emit q->implicitPlaceholderWidthChanged();
+    if (!qFuzzyCompare(size.height(), oldSize.height()))
+        emit q->implicitPlaceholderHeightChanged();
+}
+
 /*!
     \internal
 
@@ -278,6 +381,7 @@ QQuickTextField::QQuickTextField(QQuickItem *parent)
 #endif
     QObjectPrivate::connect(this, &QQuickTextInput::readOnlyChanged, d, &QQuickTextFieldPrivate::readOnlyChanged);
     QObjectPrivate::connect(this, &QQuickTextInput::echoModeChanged, d, &QQuickTextFieldPrivate::echoModeChanged);
+    QObjectPrivate::connect(this, &QQuickTextInput::fontChanged, d, &QQuickTextFieldPrivate::updateImplicitPlaceholderSize);
 }
 
 QFont QQuickTextField::font() const
@@ -351,6 +455,9 @@ void QQuickTextField::setPlaceholderText(const QString &text)
     if (d->accessibleAttached)
         d->accessibleAttached->setDescription(text);
 #endif
+    d->updateImplicitPlaceholderSize();
+    d->watchPlaceholder();
+    d->updatePlaceholder();
     emit placeholderTextChanged();
 }
 
@@ -451,6 +558,97 @@ void QQuickTextField::resetHoverEnabled()
 #endif
 }
 
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty color QtQuick.Controls::TextField::placeholderTextColor
+
+    This property holds the color of \l placeholderText. By default, the
+    placeholder text is drawn with the same color as the text.
+
+    \sa placeholderText
+*/
+QColor QQuickTextField::placeholderTextColor() const
+{
+    Q_D(const QQuickTextField);
+    return d->placeholderColor;
+}
+
+void QQuickTextField::setPlaceholderTextColor(const QColor &color)
+{
+    Q_D(QQuickTextField);
+    if (d->placeholderColor == color)
+        return;
+
+    d->placeholderColor = color;
+    d->updatePlaceholder();
+    emit placeholderTextColorChanged();
+}
+
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty real QtQuick.Controls::TextField::implicitPlaceholderWidth
+    \readonly
+
+    This property holds the implicit width of \l placeholderText. It is
+    calculated from the font metrics, without laying out the placeholder text,
+    and is \c 0 when there is no placeholder text.
+
+    \sa implicitPlaceholderHeight
+*/
+qreal QQuickTextField::implicitPlaceholderWidth() const
+{
+    Q_D(const QQuickTextField);
+    return d->implicitPlaceholderSize.width();
+}
+
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty real QtQuick.Controls::TextField::implicitPlaceholderHeight
+    \readonly
+
+    This property holds the implicit height of \l placeholderText. It is
+    calculated from the font metrics, without laying out the placeholder text.
+
+    \sa implicitPlaceholderWidth
+*/
+qreal QQuickTextField::implicitPlaceholderHeight() const
+{
+    Q_D(const QQuickTextField);
+    return d->implicitPlaceholderSize.height();
+}
+
+/*!
+    \since QtQuick.Controls 2.3 (Qt 5.10)
+    \qmlproperty bool QtQuick.Controls::TextField::placeholderItemEnabled
+
+    This property holds whether the text field draws \l placeholderText
+    itself. The placeholder item is created only when it is visible, that is,
+    when \l placeholderText is set and the text field is empty.
+
+    The default value is \c false, so that custom styles that provide a
+    placeholder item of their own do not draw the placeholder text twice.
+    The built-in styles set this property to \c true.
+
+    \sa placeholderText, placeholderTextColor
+*/
+bool QQuickTextField::isPlaceholderItemEnabled() const
+{
+    Q_D(const QQuickTextField);
+    return d->placeholderItemEnabled;
+}
+
+void QQuickTextField::setPlaceholderItemEnabled(bool enabled)
+{
+    Q_D(QQuickTextField);
+    if (d->placeholderItemEnabled == enabled)
+        return;
+
+    d->placeholderItemEnabled = enabled;
+    d->watchPlaceholder();
+    d->updatePlaceholder();
+    emit placeholderItemEnabledChanged();
+}
+
 void QQuickTextField::classBegin()
 {
     Q_D(QQuickTextField);
@@ -466,6 +664,8 @@ void QQuickTextField::componentComplete()
     if (!d->explicitHoverEnabled)
         setAcceptHoverEvents(QQuickControlPrivate::calcHoverEnabled(d->parentItem));
 #endif
+    d->updateImplicitPlaceholderSize();
+    d->updatePlaceholder();
 #if QT_CONFIG(accessibility)
     if (!d->accessibleAttached && QAccessible::isActive())
         d->accessibilityActiveChanged(true);
@@ -490,6 +690,8 @@ void QQuickTextField::geometryChanged(const QRectF &newGeometry, const QRectF &o
     Q_D(QQuickTextField);
     QQuickTextInput::geometryChanged(newGeometry, oldGeometry);
     d->resizeBackground();
+    if (d->placeholderItem && d->placeholderItem->isVisible())
+        d->updatePlaceholder();
 }
 
 QSGNode *QQuickTextField::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
@@ -543,8 +745,9 @@ void QQuickTextField::mousePressEvent(QMouseEvent *event)
     Q_D(QQuickTextField);
     d->pressHandler.mousePressEvent(event);
     if (d->pressHandler.isActive()) {
-        if (d->pressHandler.delayedMousePressEvent) {
-            QQuickTextInput::mousePressEvent(d->pressHandler.delayedMousePressEvent);
+        if (d->pressHandler.hasDelayedMousePressEvent) {
+            QMouseEvent delayedEvent = d->pressHandler.delayedMousePressEvent();
+            QQuickTextInput::mousePressEvent(&delayedEvent);
             d->pressHandler.clearDelayedMouseEvent();
         }
         QQuickTextInput::mousePressEvent(event);
@@ -556,8 +759,9 @@ void QQuickTextField::mouseMoveEvent(QMouseEvent *event)
     Q_D(QQuickTextField);
     d->pressHandler.mouseMoveEvent(event);
     if (d->pressHandler.isActive()) {
-        if (d->pressHandler.delayedMousePressEvent) {
-            QQuickTextInput::mousePressEvent(d->pressHandler.delayedMousePressEvent);
+        if (d->pressHandler.hasDelayedMousePressEvent) {
+            QMouseEvent delayedEvent = d->pressHandler.delayedMousePressEvent();
+            QQuickTextInput::mousePressEvent(&delayedEvent);
             d->pressHandler.clearDelayedMouseEvent();
         }
         QQuickTextInput::mouseMoveEvent(event);
@@ -569,8 +773,9 @@ void QQuickTextField::mouseReleaseEvent(QMouseEvent *event)
     Q_D(QQuickTextField);
     d->pressHandler.mouseReleaseEvent(event);
     if (d->pressHandler.isActive()) {
-        if (d->pressHandler.delayedMousePressEvent) {
-            QQuickTextInput::mousePressEvent(d->pressHandler.delayedMousePressEvent);
+        if (d->pressHandler.hasDelayedMousePressEvent) {
+            QMouseEvent delayedEvent = d->pressHandler.delayedMousePressEvent();
+            QQuickTextInput::mousePressEvent(&delayedEvent);
             d->pressHandler.clearDelayedMouseEvent();
         }
         QQuickTextInput::mouseReleaseEvent(event);
@@ -580,8 +785,9 @@ void QQuickTextField::mouseReleaseEvent(QMouseEvent *event)
 void QQuickTextField::mouseDoubleClickEvent(QMouseEvent *event)
 {
     Q_D(QQuickTextField);
-    if (d->pressHandler.delayedMousePressEvent) {
-        QQuickTextInput::mousePressEvent(d->pressHandler.delayedMousePressEvent);
+    if (d->pressHandler.hasDelayedMousePressEvent) {
+        QMouseEvent delayedEvent = d->pressHandler.delayedMousePressEvent();
+        QQuickTextInput::mousePressEvent(&delayedEvent);
         d->pressHandler.clearDelayedMouseEvent();
     }
     QQuickTextInput::mouseDoubleClickEvent(event);
@@ -68,6 +68,10 @@ class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickTextField : public QQuickTextInput
     Q_PROPERTY(Qt::FocusReason focusReason READ focusReason WRITE setFocusReason NOTIFY focusReasonChanged FINAL)
     Q_PROPERTY(bool hovered READ isHovered NOTIFY hoveredChanged FINAL REVISION 1)
     Q_PROPERTY(bool hoverEnabled READ isHoverEnabled WRITE setHoverEnabled RESET resetHoverEnabled NOTIFY hoverEnabledChanged FINAL REVISION 1)
+    Q_PROPERTY(QColor placeholderTextColor READ placeholderTextColor WRITE setPlaceholderTextColor NOTIFY placeholderTextColorChanged FINAL REVISION 3)
+    Q_PROPERTY(qreal implicitPlaceholderWidth READ implicitPlaceholderWidth NOTIFY implicitPlaceholderWidthChanged FINAL REVISION 3)
+    Q_PROPERTY(qreal implicitPlaceholderHeight READ implicitPlaceholderHeight NOTIFY implicitPlaceholderHeightChanged FINAL REVISION 3)
+    Q_PROPERTY(bool placeholderItemEnabled READ isPlaceholderItemEnabled WRITE setPlaceholderItemEnabled NOTIFY placeholderItemEnabledChanged FINAL REVISION 3)
 
 public:
     explicit QQuickTextField(QQuickItem *parent = nullptr);
@@ -91,6 +95,15 @@ public:
     void setHoverEnabled(bool enabled);
     void resetHoverEnabled();
 
+    QColor placeholderTextColor() const;
+    void setPlaceholderTextColor(const QColor &color);
+
+    qreal implicitPlaceholderWidth() const;
+    qreal implicitPlaceholderHeight() const;
+
+    bool isPlaceholderItemEnabled() const;
+    void setPlaceholderItemEnabled(bool enabled);
+
 Q_SIGNALS:
     void fontChanged();
     void implicitWidthChanged3();
@@ -103,6 +116,10 @@ Q_SIGNALS:
     void pressAndHold(QQuickMouseEvent *event);
     Q_REVISION(1) void pressed(QQuickMouseEvent *event);
     Q_REVISION(1) void released(QQuickMouseEvent *event);
+    Q_REVISION(3) void placeholderTextColorChanged();
+    Q_REVISION(3) void implicitPlaceholderWidthChanged();
+    Q_REVISION(3) void implicitPlaceholderHeightChanged();
+    Q_REVISION(3) void placeholderItemEnabledChanged();
 
 protected:
     void classBegin() override;
@@ -59,6 +59,7 @@
 
 QT_BEGIN_NAMESPACE
 
+class QQuickText;
 class QQuickAccessibleAttached;
 
 class QQuickTextFieldPrivate : public QQuickTextInputPrivate
@@ -92,6 +93,11 @@ public:
     void readOnlyChanged(bool isReadOnly);
     void echoModeChanged(QQuickTextField::EchoMode echoMode);
 
+    void watchPlaceholder();
+    void updatePlaceholder();
+    void updatePlaceholderAlignment();
+    void updateImplicitPlaceholderSize();
+
 #if QT_CONFIG(accessibility)
     void accessibilityActiveChanged(bool active) override;
     QAccessible::Role accessibleRole() const override;
@@ -104,6 +110,11 @@ public:
     QFont font;
     QQuickItem *background;
     QString placeholder;
+    QColor placeholderColor;
+    QSizeF implicitPlaceholderSize;
+    bool placeholderItemEnabled;
+    QQuickText *placeholderItem;
+    QVector<QMetaObject::Connection> placeholderConnections;
     Qt::FocusReason focusReason;
     QQuickPressHandler pressHandler;
     QQuickAccessibleAttached *accessibleAttached;
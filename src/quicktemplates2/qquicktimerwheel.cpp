@@ -0,0 +1,185 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Templates 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquicktimerwheel_p_p.h"
+
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qthreadstorage.h>
+
+#include <algorithm>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    QQuickTimerWheel multiplexes the short-lived timers used by controls
+    (press-and-hold, auto-repeat delay and auto-repeat interval) onto a
+    single native timer per thread.
+
+    Timers are repeating, like QBasicTimer and QObject::startTimer(), and
+    are delivered to the receiver as a regular QTimerEvent. The ids handed
+    out are negative, so they never collide with native timer ids that the
+    receiver may be handling in the same timerEvent() override.
+
+    The native timer is only re-armed when a timer is scheduled before the
+    currently armed deadline. Stopping a timer never kills the native timer;
+    a wake-up that finds nothing due simply re-arms for the next deadline,
+    or goes idle. This keeps press/release cycles from registering and
+    unregistering native timers with the event dispatcher.
+
+    Usage:
+
+    QQuickWheelTimer holdTimer;
+
+    holdTimer.start(interval, q);
+
+    void Control::timerEvent(QTimerEvent *event)
+    {
+        if (event->timerId() == d->holdTimer.timerId()) {
+            d->holdTimer.stop();
+            // ...
+        }
+    }
+*/
+
+static QThreadStorage<QQuickTimerWheel *> timerWheels;
+
+QQuickTimerWheel::QQuickTimerWheel()
+    : m_nextId(0),
+      m_armedDeadline(-1)
+{
+    m_clock.start();
+}
+
+QQuickTimerWheel *QQuickTimerWheel::instance()
+{
+    if (!timerWheels.hasLocalData())
+        timerWheels.setLocalData(new QQuickTimerWheel);
+    return timerWheels.localData();
+}
+
+int QQuickTimerWheel::start(int interval, QObject *receiver)
+{
+    Q_ASSERT(receiver);
+    // the ids are negative so that they never clash with native timer ids,
+    // and wrap around explicitly instead of overflowing
+    m_nextId = m_nextId > std::numeric_limits<int>::min() ? m_nextId - 1 : -1;
+
+    const qint64 now = m_clock.elapsed();
+    schedule({m_nextId, qMax(0, interval), now + qMax(0, interval), receiver});
+    rearm(now);
+    return m_nextId;
+}
+
+void QQuickTimerWheel::stop(int id)
+{
+    auto it = std::find_if(m_entries.begin(), m_entries.end(), [id](const Entry &entry) { return entry.id == id; });
+    if (it != m_entries.end())
+        m_entries.erase(it);
+}
+
+int QQuickTimerWheel::count() const
+{
+    return m_entries.count();
+}
+
+void QQuickTimerWheel::schedule(const Entry &entry)
+{
+    // kept sorted by deadline; there are only ever a handful of entries
+    auto it = std::upper_bound(m_entries.begin(), m_entries.end(), entry.deadline,
+                               [](qint64 deadline, const Entry &other) { return deadline < other.deadline; });
+    m_entries.insert(it, entry);
+}
+
+void QQuickTimerWheel::rearm(qint64 now)
+{
+    if (m_entries.isEmpty()) {
+        m_timer.stop();
+        m_armedDeadline = -1;
+        return;
+    }
+
+    const qint64 deadline = m_entries.first().deadline;
+    if (m_timer.isActive() && m_armedDeadline <= deadline)
+        return;
+
+    m_armedDeadline = deadline;
+    m_timer.start(int(qMax<qint64>(0, deadline - now)), this);
+}
+
+void QQuickTimerWheel::timerEvent(QTimerEvent *event)
+{
+    if (event->timerId() != m_timer.timerId()) {
+        QObject::timerEvent(event);
+        return;
+    }
+
+    m_timer.stop();
+    m_armedDeadline = -1;
+
+    const qint64 now = m_clock.elapsed();
+    while (!m_entries.isEmpty() && m_entries.first().deadline <= now) {
+        Entry entry = m_entries.takeFirst();
+
+        // reschedule before delivering, so that the receiver can stop it
+        const qint64 interval = qMax(1, entry.interval);
+        entry.deadline += interval * ((now - entry.deadline) / interval + 1);
+        schedule(entry);
+
+        QTimerEvent timerEvent(entry.id);
+        QCoreApplication::sendEvent(entry.receiver, &timerEvent);
+    }
+
+    rearm(m_clock.elapsed());
+}
+
+void QQuickWheelTimer::start(int msec, QObject *receiver)
+{
+    stop();
+    m_id = QQuickTimerWheel::instance()->start(msec, receiver);
+}
+
+void QQuickWheelTimer::stop()
+{
+    if (m_id != 0) {
+        // the wheel may already be gone if the thread is finishing
+        if (timerWheels.hasLocalData())
+            timerWheels.localData()->stop(m_id);
+        m_id = 0;
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,113 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Templates 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QQUICKTIMERWHEEL_P_P_H
+#define QQUICKTIMERWHEEL_P_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qobject.h>
+#include <QtCore/qvector.h>
+#include <QtCore/qbasictimer.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtQuickTemplates2/private/qtquicktemplates2global_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickTimerWheel : public QObject
+{
+public:
+    static QQuickTimerWheel *instance();
+
+    int start(int interval, QObject *receiver);
+    void stop(int id);
+
+    int count() const;
+
+protected:
+    void timerEvent(QTimerEvent *event) override;
+
+private:
+    QQuickTimerWheel();
+
+    struct Entry
+    {
+        int id;
+        int interval;
+        qint64 deadline;
+        QObject *receiver;
+    };
+
+    void schedule(const Entry &entry);
+    void rearm(qint64 now);
+
+    int m_nextId;
+    qint64 m_armedDeadline;
+    QBasicTimer m_timer;
+    QElapsedTimer m_clock;
+    QVector<Entry> m_entries;
+};
+
+class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickWheelTimer
+{
+public:
+    QQuickWheelTimer() : m_id(0) { }
+    ~QQuickWheelTimer() { stop(); }
+
+    void start(int msec, QObject *receiver);
+    void stop();
+
+    bool isActive() const { return m_id != 0; }
+    int timerId() const { return m_id; }
+
+private:
+    Q_DISABLE_COPY(QQuickWheelTimer)
+
+    int m_id;
+};
+
+QT_END_NAMESPACE
+
+#endif // QQUICKTIMERWHEEL_P_P_H
@@ -48,6 +48,7 @@ QT_BEGIN_NAMESPACE
     // ...
 
     velocityCalcular.startMeasuring(event->pos(), event->timestamp());
+    velocityCalcular.addSample(event->pos(), event->timestamp()); // on every move
     velocityCalcular.stopMeasuring(event->pos(), event->timestamp());
 
     // ...
@@ -56,53 +57,119 @@ QT_BEGIN_NAMESPACE
         doSomething();
     else if (velocityCalculator.velocity().x() < -someAmount)
         doSomethingElse();
+
+    The velocity is estimated with a weighted least-squares line fit over the
+    samples taken within SampleWindow milliseconds of the most recent one.
+    Newer samples weigh more than older ones, so that a finger that pauses
+    before lifting results in a velocity close to zero, rather than in the
+    average velocity of the whole gesture.
 */
 
 QQuickVelocityCalculator::QQuickVelocityCalculator()
-    : m_point1Timestamp(0),
-      m_point2Timestamp(0)
+    : m_head(-1),
+      m_count(0),
+      m_measuring(false)
 {
 }
 
 void QQuickVelocityCalculator::startMeasuring(const QPointF &point1, qint64 timestamp)
 {
-    m_point1 = point1;
+    reset();
 
-    if (timestamp != 0)
-        m_point1Timestamp = timestamp;
-    else
+    if (timestamp == 0)
         m_timer.start();
+
+    m_measuring = true;
+    addSample(point1, timestamp);
+}
+
+void QQuickVelocityCalculator::addSample(const QPointF &point, qint64 timestamp)
+{
+    if (!m_measuring)
+        return;
+
+    m_head = (m_head + 1) % SampleCount;
+    m_samples[m_head].point = point;
+    m_samples[m_head].timestamp = sampleTimestamp(timestamp);
+    m_count = qMin(m_count + 1, int(SampleCount));
 }
 
 void QQuickVelocityCalculator::stopMeasuring(const QPointF &point2, qint64 timestamp)
 {
-    if (timestamp == 0 && !m_timer.isValid()) {
+    if (!m_measuring) {
         qWarning() << "QQuickVelocityCalculator: a call to stopMeasuring() must be preceded by a call to startMeasuring()";
         return;
     }
 
-    m_point2 = point2;
-    m_point2Timestamp = timestamp != 0 ? timestamp : m_timer.elapsed();
+    addSample(point2, timestamp);
+    m_measuring = false;
     m_timer.invalidate();
 }
 
 void QQuickVelocityCalculator::reset()
 {
-    m_point1 = QPointF();
-    m_point2 = QPointF();
-    m_point1Timestamp = 0;
-    m_point2Timestamp = 0;
+    m_head = -1;
+    m_count = 0;
+    m_measuring = false;
     m_timer.invalidate();
 }
 
 QPointF QQuickVelocityCalculator::velocity() const
 {
-    if ((m_point2Timestamp == 0 || m_point1Timestamp == m_point2Timestamp) && !m_timer.isValid())
+    if (m_count < 2)
+        return QPointF();
+
+    const Sample &latest = sampleAt(0);
+
+    // Always use at least the two most recent samples, so that sparse
+    // move events (e.g. a quick flick with only press and release) still
+    // result in a velocity.
+    int count = 2;
+    while (count < m_count && latest.timestamp - sampleAt(count).timestamp <= SampleWindow)
+        ++count;
+
+    // Fit point = a + v * t, with t in seconds relative to the latest sample
+    // and weights decreasing linearly with the age of the sample.
+    qreal sw = 0, swt = 0, swtt = 0;
+    qreal swx = 0, swtx = 0, swy = 0, swty = 0;
+    for (int i = 0; i < count; ++i) {
+        const Sample &sample = sampleAt(i);
+        const qint64 age = latest.timestamp - sample.timestamp;
+        const qreal t = -age / 1000.0;
+        const qreal w = 1.0 - qMin<qreal>(age, 2 * SampleWindow - 1) / (2 * SampleWindow);
+        const QPointF p = sample.point - latest.point;
+        sw += w;
+        swt += w * t;
+        swtt += w * t * t;
+        swx += w * p.x();
+        swtx += w * t * p.x();
+        swy += w * p.y();
+        swty += w * t * p.y();
+    }
+
+    const qreal denominator = sw * swtt - swt * swt;
+    if (qFuzzyIsNull(denominator))
         return QPointF();
 
-    const qreal secondsElapsed = (m_point2Timestamp != 0 ? m_point2Timestamp - m_point1Timestamp : m_timer.elapsed()) / 1000.0;
-    const QPointF distance = m_point2 - m_point1;
-    return distance / secondsElapsed;
+    return QPointF(sw * swtx - swt * swx, sw * swty - swt * swy) / denominator;
+}
+
+int QQuickVelocityCalculator::sampleCount() const
+{
+    return m_count;
+}
+
+qint64 QQuickVelocityCalculator::sampleTimestamp(qint64 timestamp) const
+{
+    if (timestamp != 0 || !m_timer.isValid())
+        return timestamp;
+    return m_timer.elapsed();
+}
+
+const QQuickVelocityCalculator::Sample &QQuickVelocityCalculator::sampleAt(int index) const
+{
+    Q_ASSERT(index >= 0 && index < m_count);
+    return m_samples[(m_head - index + SampleCount) % SampleCount];
 }
 
 QT_END_NAMESPACE
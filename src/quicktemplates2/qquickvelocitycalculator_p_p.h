@@ -50,26 +50,43 @@
 
 #include <QtCore/qpoint.h>
 #include <QtCore/qelapsedtimer.h>
+#include <QtQuickTemplates2/private/qtquicktemplates2global_p.h>
 
 QT_BEGIN_NAMESPACE
 
-class QQuickVelocityCalculator
+class Q_QUICKTEMPLATES2_PRIVATE_EXPORT QQuickVelocityCalculator
 {
 public:
     QQuickVelocityCalculator();
 
+    // the number of samples kept, and how far back (in milliseconds) from the
+    // most recent sample they are taken into account by the velocity estimate
+    enum { SampleCount = 20, SampleWindow = 100 };
+
     void startMeasuring(const QPointF &point1, qint64 timestamp = 0);
+    void addSample(const QPointF &point, qint64 timestamp = 0);
     void stopMeasuring(const QPointF &m_point2, qint64 timestamp = 0);
     void reset();
     QPointF velocity() const;
 
+    int sampleCount() const;
+
 private:
-    QPointF m_point1;
-    QPointF m_point2;
-    qint64 m_point1Timestamp;
-    qint64 m_point2Timestamp;
+    struct Sample
+    {
+        QPointF point;
+        qint64 timestamp;
+    };
+
+    qint64 sampleTimestamp(qint64 timestamp) const;
+    const Sample &sampleAt(int index) const;
+
+    // A fixed-size ring buffer; m_head is the slot of the most recent sample.
+    Sample m_samples[SampleCount];
+    int m_head;
+    int m_count;
+    bool m_measuring;
     // When a timestamp isn't available, we must use a timer.
-    // When stopMeasuring() has been called, we store the elapsed time in point2timestamp.
     QElapsedTimer m_timer;
 };
 
@@ -0,0 +1,145 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the Qt Quick Templates 2 module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qquickvisibleareatracker_p_p.h"
+
+#include <QtCore/qmetaobject.h>
+#include <QtQuick/private/qquickflickable_p.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Connects a ScrollBar or a ScrollIndicator to the visible area of a
+    Flickable along one axis.
+
+    The ratio and position come from Flickable::visibleArea, which the
+    Flickable calculates from its own extents. That includes the extents
+    of the item views, which account for headers, footers and highlight
+    ranges. The visible area notifies synchronously, and only when a value
+    actually changes, so the size and position are always up-to-date.
+
+    QQuickFlickableVisibleArea is not exported, so its signals can't be
+    connected with typed connections. Its signals and the setters of the
+    target are resolved once and connected by method, rather than by
+    normalizing signatures on every connect and disconnect.
+*/
+
+namespace {
+    struct VisibleAreaSignals
+    {
+        explicit VisibleAreaSignals(const QMetaObject *mo)
+            : widthRatioChanged(mo->method(mo->indexOfSignal("widthRatioChanged(qreal)"))),
+              xPositionChanged(mo->method(mo->indexOfSignal("xPositionChanged(qreal)"))),
+              heightRatioChanged(mo->method(mo->indexOfSignal("heightRatioChanged(qreal)"))),
+              yPositionChanged(mo->method(mo->indexOfSignal("yPositionChanged(qreal)")))
+        {
+        }
+
+        QMetaMethod widthRatioChanged;
+        QMetaMethod xPositionChanged;
+        QMetaMethod heightRatioChanged;
+        QMetaMethod yPositionChanged;
+    };
+}
+
+// every Flickable has the same kind of visible area
+static const VisibleAreaSignals &visibleAreaSignals(const QObject *area)
+{
+    static const VisibleAreaSignals areaSignals(area->metaObject());
+    return areaSignals;
+}
+
+static QMetaMethod setterMethod(const QObject *target, const char *signature)
+{
+    const QMetaObject *mo = target->metaObject();
+    return mo->method(mo->indexOfSlot(signature));
+}
+
+QQuickVisibleAreaTracker::QQuickVisibleAreaTracker()
+    : m_orientation(Qt::Vertical),
+      m_flickable(nullptr),
+      m_area(nullptr)
+{
+}
+
+QQuickFlickable *QQuickVisibleAreaTracker::flickable() const
+{
+    return m_flickable;
+}
+
+void QQuickVisibleAreaTracker::setFlickable(QQuickFlickable *flickable, Qt::Orientation orientation, QObject *target)
+{
+    QObject::disconnect(m_sizeConnection);
+    QObject::disconnect(m_positionConnection);
+
+    m_flickable = flickable;
+    m_orientation = orientation;
+    m_area = nullptr;
+
+    if (!flickable || !target)
+        return;
+
+    m_area = flickable->property("visibleArea").value<QObject *>();
+    if (!m_area)
+        return;
+
+    const VisibleAreaSignals &areaSignals = visibleAreaSignals(m_area);
+    const QMetaMethod setSize = setterMethod(target, "setSize(qreal)");
+    const QMetaMethod setPosition = setterMethod(target, "setPosition(qreal)");
+    if (orientation == Qt::Horizontal) {
+        m_sizeConnection = QObject::connect(m_area, areaSignals.widthRatioChanged, target, setSize);
+        m_positionConnection = QObject::connect(m_area, areaSignals.xPositionChanged, target, setPosition);
+    } else {
+        m_sizeConnection = QObject::connect(m_area, areaSignals.heightRatioChanged, target, setSize);
+        m_positionConnection = QObject::connect(m_area, areaSignals.yPositionChanged, target, setPosition);
+    }
+}
+
+qreal QQuickVisibleAreaTracker::size() const
+{
+    if (!m_area)
+        return 0;
+    return m_area->property(m_orientation == Qt::Horizontal ? "widthRatio" : "heightRatio").toReal();
+}
+
+qreal QQuickVisibleAreaTracker::position() const
+{
+    if (!m_area)
+        return 0;
+    return m_area->property(m_orientation == Qt::Horizontal ? "xPosition" : "yPosition").toReal();
+}
+
+QT_END_NAMESPACE
@@ -76,11 +76,13 @@ HEADERS += \
     $$PWD/qquicktextarea_p_p.h \
     $$PWD/qquicktextfield_p.h \
     $$PWD/qquicktextfield_p_p.h \
+    $$PWD/qquicktimerwheel_p_p.h \
     $$PWD/qquicktoolbar_p.h \
     $$PWD/qquicktoolbutton_p.h \
     $$PWD/qquicktoolseparator_p.h \
     $$PWD/qquicktooltip_p.h \
-    $$PWD/qquickvelocitycalculator_p_p.h
+    $$PWD/qquickvelocitycalculator_p_p.h \
+    $$PWD/qquickvisibleareatracker_p_p.h
 
 SOURCES += \
     $$PWD/qquickabstractbutton.cpp \
@@ -139,11 +141,13 @@ SOURCES += \
     $$PWD/qquicktabbutton.cpp \
     $$PWD/qquicktextarea.cpp \
     $$PWD/qquicktextfield.cpp \
+    $$PWD/qquicktimerwheel.cpp \
     $$PWD/qquicktoolbar.cpp \
     $$PWD/qquicktoolbutton.cpp \
     $$PWD/qquicktoolseparator.cpp \
     $$PWD/qquicktooltip.cpp \
-    $$PWD/qquickvelocitycalculator.cpp
+    $$PWD/qquickvelocitycalculator.cpp \
+    $$PWD/qquickvisibleareatracker.cpp
 
 qtConfig(quick-listview):qtConfig(quick-pathview) {
     HEADERS += \
@@ -761,17 +761,18 @@ void tst_applicationwindow::layout()
     QCOMPARE(content->width(), qreal(window->width()));
     QCOMPARE(content->height(), window->height() - header->height() - footer->height());
 
+    // relayout happens on the next polish pass
     header->setVisible(false);
+    QTRY_COMPARE(content->y(), 0.0);
     QCOMPARE(content->x(), 0.0);
-    QCOMPARE(content->y(), 0.0);
     QCOMPARE(content->width(), qreal(window->width()));
     QCOMPARE(content->height(), window->height() - footer->height());
 
     footer->setVisible(false);
+    QTRY_COMPARE(content->height(), qreal(window->height()));
     QCOMPARE(content->x(), 0.0);
     QCOMPARE(content->y(), 0.0);
     QCOMPARE(content->width(), qreal(window->width()));
-    QCOMPARE(content->height(), qreal(window->height()));
 }
 
 QTEST_MAIN(tst_applicationwindow)
@@ -14,13 +14,15 @@ SUBDIRS += \
     qquickiconimage \
     qquickmaterialstyle \
     qquickmaterialstyleconf \
+    qquickpaddedrectangle \
     qquickstyle \
     qquickstyleselector \
     qquickuniversalstyle \
     qquickuniversalstyleconf \
     revisions \
     sanity \
-    snippets
+    snippets \
+    velocitycalculator
 
 # QTBUG-50295
 !linux: SUBDIRS += \
@@ -110,6 +110,57 @@ TestCase {
         model.destroy()
     }
 
+    Component {
+        id: signalSpy
+        SignalSpy { }
+    }
+
+    function test_incremental() {
+        var model = calendarModel.createObject(testCase, {from: new Date(2016, 0, 1), to: new Date(2016, 11, 31)})
+        verify(model)
+        compare(model.count, 12)
+
+        var insertSpy = signalSpy.createObject(model, {target: model, signalName: "rowsInserted"})
+        var removeSpy = signalSpy.createObject(model, {target: model, signalName: "rowsRemoved"})
+        var resetSpy = signalSpy.createObject(model, {target: model, signalName: "modelReset"})
+        var dataSpy = signalSpy.createObject(model, {target: model, signalName: "dataChanged"})
+        var countSpy = signalSpy.createObject(model, {target: model, signalName: "countChanged"})
+
+        // prepend a month
+        model.from = new Date(2015, 11, 1)
+        compare(model.count, 13)
+        compare(insertSpy.count, 1)
+        compare(insertSpy.signalArguments[0][1], 0)
+        compare(insertSpy.signalArguments[0][2], 0)
+        compare(model.monthAt(0), 11)
+        compare(model.yearAt(0), 2015)
+
+        // remove two months from the end
+        model.to = new Date(2016, 9, 31)
+        compare(model.count, 11)
+        compare(removeSpy.count, 1)
+        compare(removeSpy.signalArguments[0][1], 11)
+        compare(removeSpy.signalArguments[0][2], 12)
+
+        // same months, different days
+        model.from = new Date(2015, 11, 15)
+        compare(model.count, 11)
+
+        // shift by a month at both ends
+        model.from = new Date(2016, 0, 1)
+        model.to = new Date(2016, 10, 30)
+        compare(model.count, 11)
+        compare(insertSpy.count, 2)
+        compare(removeSpy.count, 2)
+        compare(model.indexOf(2016, 10), 10)
+
+        compare(resetSpy.count, 0)
+        compare(dataSpy.count, 0)
+        compare(countSpy.count, 4)
+
+        model.destroy()
+    }
+
     function test_instantiator() {
         var inst = instantiator.createObject(testCase)
         verify(inst)
@@ -50,8 +50,8 @@
 
 import QtQuick 2.2
 import QtTest 1.0
-import QtQuick.Controls 2.2
-import QtQuick.Templates 2.2 as T
+import QtQuick.Controls 2.3
+import QtQuick.Templates 2.3 as T
 
 TestCase {
     id: testCase
@@ -71,6 +71,11 @@ TestCase {
         Rectangle { }
     }
 
+    Component {
+        id: signalSpy
+        SignalSpy { }
+    }
+
     function test_implicitSize() {
         var control = createTemporaryObject(container, testCase)
         verify(control)
@@ -90,4 +95,86 @@ TestCase {
         compare(control.implicitWidth, 210)
         compare(control.implicitHeight, 220)
     }
+
+    function test_bulk() {
+        var control = createTemporaryObject(container, testCase)
+        verify(control)
+
+        var countSpy = signalSpy.createObject(control, {target: control, signalName: "countChanged"})
+        verify(countSpy.valid)
+        var childrenSpy = signalSpy.createObject(control, {target: control, signalName: "contentChildrenChanged"})
+        verify(childrenSpy.valid)
+        var currentIndexSpy = signalSpy.createObject(control, {target: control, signalName: "currentIndexChanged"})
+        verify(currentIndexSpy.valid)
+
+        var items = []
+        for (var i = 0; i < 5; ++i)
+            items.push(rectangle.createObject(testCase, {objectName: "item" + i}))
+
+        // insert into an empty container
+        control.insertItems(0, [items[0], items[1], items[2]])
+        compare(control.count, 3)
+        compare(control.currentIndex, 0)
+        compare(control.currentItem, items[0])
+        compare(countSpy.count, 1)
+        compare(childrenSpy.count, 1)
+        compare(currentIndexSpy.count, 1)
+
+        // insert before the current item, ignoring items that are already there
+        control.insertItems(0, [items[3], items[0], items[4]])
+        compare(control.count, 5)
+        compare(control.itemAt(0), items[3])
+        compare(control.itemAt(1), items[4])
+        compare(control.itemAt(2), items[0])
+        compare(control.currentIndex, 2)
+        compare(control.currentItem, items[0])
+        compare(countSpy.count, 2)
+        compare(childrenSpy.count, 2)
+        compare(currentIndexSpy.count, 2)
+
+        // move a block that contains the current item: [3, 4, 0, 1, 2] -> [1, 2, 3, 4, 0]
+        control.moveItems(3, 0, 2)
+        compare(control.itemAt(0), items[1])
+        compare(control.itemAt(1), items[2])
+        compare(control.itemAt(4), items[0])
+        compare(control.currentIndex, 4)
+        compare(control.currentItem, items[0])
+        compare(countSpy.count, 2)
+        compare(childrenSpy.count, 3)
+        compare(currentIndexSpy.count, 3)
+
+        // remove before the current item: [1, 2, 3, 4, 0] -> [1, 4, 0]
+        control.removeItems(1, 2)
+        compare(control.count, 3)
+        compare(control.itemAt(1), items[4])
+        compare(control.currentIndex, 2)
+        compare(control.currentItem, items[0])
+        compare(countSpy.count, 3)
+        compare(childrenSpy.count, 4)
+        compare(currentIndexSpy.count, 4)
+        compare(items[2].parent, null)
+
+        // replace, keeping the current item: [1, 4, 0] -> [0, 2, 3]
+        control.replaceItems([items[0], items[2], items[3]])
+        compare(control.count, 3)
+        compare(control.itemAt(0), items[0])
+        compare(control.itemAt(1), items[2])
+        compare(control.itemAt(2), items[3])
+        compare(control.currentIndex, 0)
+        compare(control.currentItem, items[0])
+        compare(countSpy.count, 3)
+        compare(childrenSpy.count, 5)
+        compare(currentIndexSpy.count, 5)
+
+        // remove an out-of-bounds range
+        control.removeItems(1, 10)
+        compare(control.count, 1)
+        compare(control.currentIndex, 0)
+        compare(countSpy.count, 4)
+        compare(childrenSpy.count, 6)
+        compare(currentIndexSpy.count, 5)
+
+        for (i = 0; i < items.length; ++i)
+            items[i].destroy()
+    }
 }
@@ -311,13 +311,14 @@ TestCase {
         compare(ySpy.count, 2)
 
         // moving parent outside margins triggers change notifiers
+        // once the popup has been repositioned in the next polish pass
         control.parent.x = -50
-        compare(control.x, 50 + control.leftMargin)
+        tryCompare(control, "x", 50 + control.leftMargin)
         compare(xSpy.count, 3)
         compare(ySpy.count, 2)
 
         control.parent.y = -60
-        compare(control.y, 60 + control.topMargin)
+        tryCompare(control, "y", 60 + control.topMargin)
         compare(xSpy.count, 3)
         compare(ySpy.count, 3)
     }
@@ -1157,6 +1158,53 @@ TestCase {
         compare(window.overlay.children.length, 0) // popup + overlay removed
     }
 
+    Component {
+        id: dimmerTest
+        ApplicationWindow {
+            property alias popup: popup
+            visible: true
+            overlay.modeless: Rectangle {
+                objectName: tag
+            }
+            Popup {
+                id: popup
+                property string tag: "dimmer"
+                dim: true
+            }
+        }
+    }
+
+    function test_dimmerReuse() {
+        var window = createTemporaryObject(dimmerTest, testCase)
+        verify(window)
+
+        window.requestActivate()
+        tryCompare(window, "active", true)
+
+        window.popup.open()
+        tryCompare(window.popup, "visible", true)
+        var dimmer = findOverlay(window, window.popup)
+        verify(dimmer)
+        // the popup is the context object of its dimmer
+        compare(dimmer.objectName, "dimmer")
+
+        // toggling dim re-uses the same dimmer
+        window.popup.dim = false
+        compare(window.overlay.children.length, 1)
+        window.popup.dim = true
+        compare(window.overlay.children.length, 2)
+        compare(findOverlay(window, window.popup), dimmer)
+
+        // so does re-opening the popup
+        window.popup.close()
+        tryCompare(window.popup, "visible", false)
+        compare(window.overlay.children.length, 0)
+        window.popup.open()
+        tryCompare(window.popup, "visible", true)
+        compare(findOverlay(window, window.popup), dimmer)
+        tryCompare(dimmer, "opacity", 1.0)
+    }
+
     function test_attached_applicationwindow() {
         var control = createTemporaryObject(popupControl, applicationWindow.contentItem)
         verify(control)
@@ -1241,6 +1289,79 @@ TestCase {
         compare(control.y, (control.parent.height - control.height) / 2)
     }
 
+    function test_ancestorGeometry() {
+        var grandParent = createTemporaryObject(rect, testCase, {width: 200, height: 200})
+        verify(grandParent)
+        var parentItem = rect.createObject(grandParent, {x: 10, y: 10, width: 100, height: 100})
+        verify(parentItem)
+
+        var control = popupControl.createObject(parentItem, {x: 10, y: 10, width: 50, height: 50, margins: -1})
+        verify(control)
+
+        var xSpy = signalSpy.createObject(testCase, {target: control, signalName: "xChanged"})
+        verify(xSpy.valid)
+
+        control.open()
+        verify(control.visible)
+        compare(control.contentItem.parent.x, 20)
+        compare(control.contentItem.parent.y, 20)
+
+        // moving an ancestor repositions the popup in the next polish pass
+        grandParent.x = 30
+        grandParent.x = 40
+        tryCompare(control.contentItem.parent, "x", 60)
+        compare(control.contentItem.parent.y, 20)
+        compare(control.x, 10)
+        compare(xSpy.count, 0)
+
+        // ancestor geometry changes that do not move the parent item keep the popup in place
+        grandParent.width = 300
+        grandParent.height = 300
+        waitForRendering(control.contentItem)
+        compare(control.contentItem.parent.x, 60)
+        compare(control.contentItem.parent.y, 20)
+
+        // re-parented ancestors are tracked too
+        var newGrandParent = createTemporaryObject(rect, testCase, {x: 100, y: 100, width: 200, height: 200})
+        verify(newGrandParent)
+        parentItem.parent = newGrandParent
+        tryCompare(control.contentItem.parent, "x", 120)
+        compare(control.contentItem.parent.y, 120)
+
+        grandParent.x = 0
+        newGrandParent.y = 50
+        tryCompare(control.contentItem.parent, "y", 70)
+        compare(control.contentItem.parent.x, 120)
+
+        control.destroy()
+        xSpy.destroy()
+    }
+
+    function test_parentGeometry() {
+        var parentItem = createTemporaryObject(rect, testCase, {x: 10, y: 10, width: 100, height: 100})
+        verify(parentItem)
+
+        var control = popupControl.createObject(parentItem, {x: 10, y: 10, width: 50, height: 50, margins: -1})
+        verify(control)
+
+        control.open()
+        verify(control.visible)
+        compare(control.contentItem.parent.x, 20)
+        compare(control.contentItem.parent.y, 20)
+
+        // a burst of parent moves and resizes is handled in the next polish pass
+        parentItem.x = 20
+        parentItem.width = 120
+        parentItem.x = 30
+        parentItem.y = 40
+        compare(control.contentItem.parent.x, 20)
+        compare(control.contentItem.parent.y, 20)
+        tryCompare(control.contentItem.parent, "x", 40)
+        compare(control.contentItem.parent.y, 50)
+
+        control.destroy()
+    }
+
     function test_windowParent() {
         var control = popupControl.createObject(applicationWindow, {width: 100, height: 100})
         verify(control)
@@ -82,6 +82,18 @@ TestCase {
         }
     }
 
+    Component {
+        id: listView
+        ListView {
+            width: 100
+            height: 100
+            model: 10
+            header: Item { width: 100; height: 50 }
+            footer: Item { width: 100; height: 50 }
+            delegate: Item { width: 100; height: 20 }
+        }
+    }
+
     function test_attach() {
         var container = createTemporaryObject(flickable, testCase)
         verify(container)
@@ -186,6 +198,70 @@ TestCase {
         compare(horizontal.width, oldWidth)
     }
 
+    function test_visibleArea() {
+        var container = createTemporaryObject(flickable, testCase)
+        verify(container)
+        waitForRendering(container)
+
+        var vertical = scrollBar.createObject(container)
+        verify(vertical)
+        container.ScrollBar.vertical = vertical
+        compare(vertical.size, 0.5)
+        compare(vertical.position, 0.0)
+
+        var positionSpy = signalSpy.createObject(vertical, {target: vertical, signalName: "positionChanged"})
+        verify(positionSpy.valid)
+        var sizeSpy = signalSpy.createObject(vertical, {target: vertical, signalName: "sizeChanged"})
+        verify(sizeSpy.valid)
+
+        // the visible area is followed synchronously
+        container.contentY = 50
+        compare(positionSpy.count, 1)
+        compare(vertical.position, container.visibleArea.yPosition)
+        compare(vertical.position, 0.25)
+        compare(sizeSpy.count, 0)
+
+        container.contentY = 100
+        compare(positionSpy.count, 2)
+        compare(vertical.position, 0.5)
+
+        // changes that do not affect the visible area are not notified
+        container.contentWidth = 400
+        compare(positionSpy.count, 2)
+        compare(sizeSpy.count, 0)
+
+        container.contentHeight = 400
+        compare(sizeSpy.count, 1)
+        compare(vertical.size, container.visibleArea.heightRatio)
+        compare(vertical.size, 0.25)
+        compare(vertical.position, container.visibleArea.yPosition)
+
+        container.ScrollBar.vertical = null
+        var oldPosition = vertical.position
+        container.contentY = 0
+        compare(vertical.position, oldPosition)
+    }
+
+    function test_visibleAreaItemView() {
+        var container = createTemporaryObject(listView, testCase)
+        verify(container)
+        waitForRendering(container)
+
+        var vertical = scrollBar.createObject(container)
+        verify(vertical)
+        container.ScrollBar.vertical = vertical
+
+        // the header and the footer are part of the extents of the view
+        compare(vertical.size, container.visibleArea.heightRatio)
+        compare(vertical.position, container.visibleArea.yPosition)
+        compare(vertical.size, 100 / 300)
+
+        container.positionViewAtEnd()
+        compare(vertical.size, container.visibleArea.heightRatio)
+        compare(vertical.position, container.visibleArea.yPosition)
+        fuzzyCompare(vertical.position + vertical.size, 1.0, 0.0001)
+    }
+
     function test_mouse_data() {
         return [
             { tag: "horizontal", properties: { visible: true, orientation: Qt.Horizontal, width: testCase.width } },
@@ -50,7 +50,7 @@
 
 import QtQuick 2.2
 import QtTest 1.0
-import QtQuick.Controls 2.2
+import QtQuick.Controls 2.3
 
 TestCase {
     id: testCase
@@ -397,6 +397,83 @@ TestCase {
         }
     }
 
+    function test_displayText() {
+        var control = createTemporaryObject(spinBox, testCase, {value: 1234})
+        verify(control)
+
+        compare(control.displayText, Number(1234).toLocaleString(control.locale, "f", 0))
+        compare(control.contentItem.text, control.displayText)
+
+        var spy = signalSpy.createObject(control, {target: control, signalName: "displayTextChanged"})
+        verify(spy.valid)
+
+        control.value = 5
+        compare(control.displayText, "5")
+        compare(spy.count, 1)
+
+        control.textFromValue = function(value) { return "#" + value }
+        compare(control.displayText, "#5")
+        compare(spy.count, 2)
+
+        control.value = 6
+        compare(control.displayText, "#6")
+        compare(spy.count, 3)
+    }
+
+    function test_displayTextDependencies() {
+        var control = createTemporaryQmlObject("import QtQuick 2.0; import QtQuick.Controls 2.3; SpinBox { property string prefix: '#'; value: 5; textFromValue: function(value) { return prefix + value } }", testCase)
+        verify(control)
+        compare(control.displayText, "#5")
+
+        var spy = signalSpy.createObject(control, {target: control, signalName: "displayTextChanged"})
+        verify(spy.valid)
+
+        control.prefix = "$"
+        compare(control.displayText, "$5")
+        compare(spy.count, 1)
+
+        control.value = 6
+        compare(control.displayText, "$6")
+        compare(spy.count, 2)
+
+        control.prefix = "%"
+        compare(control.displayText, "%6")
+        compare(spy.count, 3)
+    }
+
+    function test_decimals() {
+        var control = createTemporaryObject(spinBox, testCase, {from: 0, to: 10000, value: 314, stepSize: 5, editable: true})
+        verify(control)
+        control.locale = Qt.locale("en_US")
+
+        compare(control.decimals, 0)
+        compare(control.displayText, "314")
+
+        control.decimals = 2
+        compare(control.displayText, "3.14")
+
+        control.increase()
+        compare(control.value, 319)
+        compare(control.displayText, "3.19")
+
+        control.contentItem.forceActiveFocus()
+        control.contentItem.selectAll()
+        keyClick(Qt.Key_2)
+        keyClick(Qt.Key_Period)
+        keyClick(Qt.Key_7)
+        keyClick(Qt.Key_2)
+        // the default validator rejects a third decimal
+        keyClick(Qt.Key_8)
+        compare(control.contentItem.text, "2.72")
+        keyClick(Qt.Key_Return)
+        compare(control.value, 272)
+        compare(control.displayText, "2.72")
+
+        control.decimals = -1
+        compare(control.decimals, 0)
+        compare(control.displayText, "272")
+    }
+
     function test_baseline() {
         var control = createTemporaryObject(spinBox, testCase)
         verify(control)
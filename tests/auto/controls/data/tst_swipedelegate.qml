@@ -1522,6 +1522,27 @@ TestCase {
         tryCompare(control.background, "x", 0);
     }
 
+    function test_incubatedItemSize() {
+        var control = createTemporaryObject(openSwipeDelegateComponent, testCase);
+        verify(control);
+
+        // The items are incubated once the control is pressed. Give the right item
+        // time to incubate before the click opens it; its size bindings refer to
+        // the parent, which must already be set.
+        compare(control.swipe.rightItem, null);
+        mousePress(control, control.width / 2, control.height / 2, Qt.LeftButton);
+        compare(control.swipe.rightItem, null);
+        wait(50);
+        mouseRelease(control, control.width / 2, control.height / 2, Qt.LeftButton);
+
+        tryCompare(control.swipe, "position", SwipeDelegate.Right);
+        verify(control.swipe.rightItem);
+        compare(control.swipe.rightItem.parent, control);
+        compare(control.swipe.rightItem.visible, true);
+        compare(control.swipe.rightItem.width, control.width);
+        compare(control.swipe.rightItem.height, control.height);
+    }
+
     Component {
         id: animationSwipeDelegateComponent
 
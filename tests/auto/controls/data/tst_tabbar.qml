@@ -549,4 +549,51 @@ TestCase {
         tryCompare(tab2, "width", expectedWidth)
         tryCompare(tab3, "width", expectedWidth)
     }
+
+    function test_resetWidth() {
+        var control = createTemporaryObject(tabBar, testCase, {width: 200})
+
+        var tab1 = tabButton.createObject(control, {text: "First"})
+        control.addItem(tab1)
+        var tab2 = tabButton.createObject(control, {text: "Second"})
+        control.addItem(tab2)
+        tryCompare(tab1, "width", (control.width - control.spacing) / 2)
+
+        // an explicit width equal to the implicit width
+        tab2.width = tab2.implicitWidth
+        tryCompare(tab1, "width", control.width - control.spacing - tab2.implicitWidth)
+        compare(tab2.width, tab2.implicitWidth)
+
+        // resetting it doesn't change the geometry of the tab,
+        // but the tab must be resized again on the next layout
+        tab2.width = undefined
+        control.width = 300
+        tryCompare(tab1, "width", (control.width - control.spacing) / 2)
+        tryCompare(tab2, "width", (control.width - control.spacing) / 2)
+    }
+
+    function test_contentHeight() {
+        var control = createTemporaryObject(tabBar, testCase, {width: 200})
+
+        var tab1 = tabButton.createObject(control, {text: "First", implicitHeight: 30})
+        control.addItem(tab1)
+        var tab2 = tabButton.createObject(control, {text: "Second", implicitHeight: 50})
+        control.addItem(tab2)
+        var tab3 = tabButton.createObject(control, {text: "Third", implicitHeight: 50})
+        control.addItem(tab3)
+        tryCompare(control, "contentHeight", 50)
+
+        // the maximum is shared by two tabs
+        control.removeItem(2)
+        tryCompare(control, "contentHeight", 50)
+
+        tab2.implicitHeight = 40
+        tryCompare(control, "contentHeight", 40)
+
+        control.removeItem(1)
+        tryCompare(control, "contentHeight", 30)
+
+        tab1.implicitHeight = 60
+        tryCompare(control, "contentHeight", 60)
+    }
 }
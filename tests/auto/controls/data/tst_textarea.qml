@@ -50,7 +50,7 @@
 
 import QtQuick 2.2
 import QtTest 1.0
-import QtQuick.Controls 2.2
+import QtQuick.Controls 2.3
 
 TestCase {
     id: testCase
@@ -164,6 +164,80 @@ TestCase {
         }
     }
 
+    function test_placeholder() {
+        var control = createTemporaryObject(textArea, testCase)
+        verify(control)
+
+        function findPlaceholder(item) {
+            for (var i = 0; i < item.children.length; ++i) {
+                if (item.children[i].hasOwnProperty("elide"))
+                    return item.children[i]
+            }
+            return null
+        }
+
+        // not created until there is a placeholder text to show
+        compare(findPlaceholder(control), null)
+        compare(control.implicitPlaceholderWidth, 0)
+        verify(control.implicitPlaceholderHeight > 0)
+
+        var widthSpy = signalSpy.createObject(control, {target: control, signalName: "implicitPlaceholderWidthChanged"})
+        verify(widthSpy.valid)
+
+        control.placeholderText = "Placeholder"
+        compare(widthSpy.count, 1)
+        verify(control.implicitPlaceholderWidth > 0)
+
+        var placeholder = findPlaceholder(control)
+        verify(placeholder)
+        verify(placeholder.visible)
+        compare(placeholder.text, "Placeholder")
+
+        control.placeholderTextColor = "#ff0000"
+        compare(placeholder.color, "#ff0000")
+
+        control.text = "Text"
+        verify(!placeholder.visible)
+
+        control.text = ""
+        verify(placeholder.visible)
+        compare(findPlaceholder(control), placeholder)
+
+        // hidden again, but not destroyed, without a placeholder text
+        control.placeholderText = ""
+        verify(!placeholder.visible)
+        compare(findPlaceholder(control), placeholder)
+
+        // the template only provides a placeholder when asked to
+        var bare = createTemporaryQmlObject("import QtQuick.Templates 2.3 as T; T.TextArea { placeholderText: 'Placeholder' }", testCase)
+        verify(bare)
+        verify(!bare.placeholderItemEnabled)
+        compare(findPlaceholder(bare), null)
+
+        bare.placeholderItemEnabled = true
+        placeholder = findPlaceholder(bare)
+        verify(placeholder)
+        verify(placeholder.visible)
+
+        bare.placeholderItemEnabled = false
+        verify(!placeholder.visible)
+    }
+
+    function test_placeholderWrap() {
+        var control = createTemporaryObject(textArea, testCase, {width: 200, placeholderText: "Lorem ipsum dolor sit amet, consectetur adipiscing elit"})
+        verify(control)
+
+        var singleLineHeight = control.implicitPlaceholderHeight
+        verify(control.implicitPlaceholderWidth > control.width)
+
+        control.wrapMode = TextArea.Wrap
+        verify(control.implicitPlaceholderWidth <= control.width - control.leftPadding - control.rightPadding)
+        verify(control.implicitPlaceholderHeight > singleLineHeight)
+
+        control.wrapMode = TextArea.NoWrap
+        compare(control.implicitPlaceholderHeight, singleLineHeight)
+    }
+
     function test_font_explicit_attributes_data() {
         return [
             {tag: "bold", value: true},
@@ -218,8 +292,9 @@ TestCase {
         verify(textArea.contentWidth > 0)
         verify(textArea.contentHeight > 200)
 
-        compare(control.contentWidth, textArea.contentWidth + textArea.leftPadding + textArea.rightPadding)
-        compare(control.contentHeight, textArea.contentHeight + textArea.topPadding + textArea.bottomPadding)
+        // synchronized in the next polish pass
+        tryCompare(control, "contentWidth", textArea.contentWidth + textArea.leftPadding + textArea.rightPadding)
+        tryCompare(control, "contentHeight", textArea.contentHeight + textArea.topPadding + textArea.bottomPadding)
 
         compare(textArea.cursorPosition, 0)
 
@@ -244,6 +319,40 @@ TestCase {
         compare(textArea.cursorPosition, center) // no change
     }
 
+    function test_followTail() {
+        var control = createTemporaryObject(flickable, testCase)
+        verify(control)
+
+        var textArea = control.TextArea.flickable
+        verify(textArea)
+        compare(textArea.followTail, false)
+        textArea.followTail = true
+
+        var contentHeightSpy = signalSpy.createObject(control, {target: control, signalName: "contentHeightChanged"})
+        verify(contentHeightSpy.valid)
+
+        // appending many lines within one frame resizes the content once
+        for (var i = 0; i < 100; ++i)
+            textArea.insert(textArea.length, "line " + i + "\n")
+        compare(contentHeightSpy.count, 0)
+        tryCompare(control, "contentHeight", textArea.contentHeight + textArea.topPadding + textArea.bottomPadding)
+        compare(contentHeightSpy.count, 1)
+        verify(control.contentHeight > control.height)
+        compare(control.contentY, control.contentHeight - control.height)
+
+        // scrolled away from the tail
+        control.contentY = 0
+        textArea.insert(textArea.length, "more\n")
+        tryCompare(control, "contentHeight", textArea.contentHeight + textArea.topPadding + textArea.bottomPadding)
+        compare(control.contentY, 0)
+
+        // back at the tail
+        control.contentY = control.contentHeight - control.height
+        textArea.insert(textArea.length, "even more\n")
+        tryCompare(control, "contentHeight", textArea.contentHeight + textArea.topPadding + textArea.bottomPadding)
+        compare(control.contentY, control.contentHeight - control.height)
+    }
+
     function test_warning() {
         ignoreWarning(Qt.resolvedUrl("tst_textarea.qml") + ":55:1: QML TestCase: TextArea must be attached to a Flickable")
         testCase.TextArea.flickable = null
@@ -50,7 +50,7 @@
 
 import QtQuick 2.2
 import QtTest 1.0
-import QtQuick.Controls 2.2
+import QtQuick.Controls 2.3
 
 TestCase {
     id: testCase
@@ -175,6 +175,65 @@ TestCase {
         }
     }
 
+    function test_placeholder() {
+        var control = createTemporaryObject(textField, testCase)
+        verify(control)
+
+        function findPlaceholder(item) {
+            for (var i = 0; i < item.children.length; ++i) {
+                if (item.children[i].hasOwnProperty("elide"))
+                    return item.children[i]
+            }
+            return null
+        }
+
+        // not created until there is a placeholder text to show
+        compare(findPlaceholder(control), null)
+        compare(control.implicitPlaceholderWidth, 0)
+        verify(control.implicitPlaceholderHeight > 0)
+
+        var widthSpy = signalSpy.createObject(control, {target: control, signalName: "implicitPlaceholderWidthChanged"})
+        verify(widthSpy.valid)
+
+        control.placeholderText = "Placeholder"
+        compare(widthSpy.count, 1)
+        verify(control.implicitPlaceholderWidth > 0)
+
+        var placeholder = findPlaceholder(control)
+        verify(placeholder)
+        verify(placeholder.visible)
+        compare(placeholder.text, "Placeholder")
+
+        control.placeholderTextColor = "#ff0000"
+        compare(placeholder.color, "#ff0000")
+
+        control.text = "Text"
+        verify(!placeholder.visible)
+
+        control.text = ""
+        verify(placeholder.visible)
+        compare(findPlaceholder(control), placeholder)
+
+        // hidden again, but not destroyed, without a placeholder text
+        control.placeholderText = ""
+        verify(!placeholder.visible)
+        compare(findPlaceholder(control), placeholder)
+
+        // the template only provides a placeholder when asked to
+        var bare = createTemporaryQmlObject("import QtQuick.Templates 2.3 as T; T.TextField { placeholderText: 'Placeholder' }", testCase)
+        verify(bare)
+        verify(!bare.placeholderItemEnabled)
+        compare(findPlaceholder(bare), null)
+
+        bare.placeholderItemEnabled = true
+        placeholder = findPlaceholder(bare)
+        verify(placeholder)
+        verify(placeholder.visible)
+
+        bare.placeholderItemEnabled = false
+        verify(!placeholder.visible)
+    }
+
     function test_font_explicit_attributes_data() {
         return [
             {tag: "bold", value: true},
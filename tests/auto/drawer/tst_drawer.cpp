@@ -69,6 +69,8 @@ private slots:
     void dragMargin_data();
     void dragMargin();
 
+    void settle();
+
     void reposition();
     void header();
 
@@ -336,6 +338,59 @@ void tst_Drawer::dragMargin()
     QTest::mouseRelease(window, Qt::LeftButton, Qt::NoModifier, QPoint(window->width() - rightDistance, drawer->height() / 2));
 }
 
+void tst_Drawer::settle()
+{
+    QQuickApplicationHelper helper(this, QStringLiteral("applicationwindow.qml"));
+
+    QQuickApplicationWindow *window = helper.appWindow;
+    window->show();
+    window->requestActivate();
+    QVERIFY(QTest::qWaitForWindowActive(window));
+
+    QQuickDrawer *drawer = helper.appWindow->property("drawer").value<QQuickDrawer*>();
+    QVERIFY(drawer);
+    QQuickItem *popupItem = drawer->popupItem();
+
+    QSignalSpy xSpy(drawer, &QQuickDrawer::xChanged);
+    QVERIFY(xSpy.isValid());
+    QSignalSpy openedSpy(drawer, &QQuickDrawer::opened);
+    QVERIFY(openedSpy.isValid());
+    QSignalSpy closedSpy(drawer, &QQuickDrawer::closed);
+    QVERIFY(closedSpy.isValid());
+
+    const int y = drawer->height() / 2;
+
+    // drag half-way open
+    QTest::mousePress(window, Qt::LeftButton, Qt::NoModifier, QPoint(0, y));
+    QTest::mouseMove(window, QPoint(drawer->width() * 0.25, y), 16);
+    QTest::mouseMove(window, QPoint(drawer->width() * 0.5, y), 16);
+    QCOMPARE(drawer->position(), qreal(0.5));
+    QVERIFY(xSpy.count() > 0);
+    QCOMPARE(drawer->x(), popupItem->x());
+
+    // the enter transition is finalized once the drawer has settled open
+    QTest::mouseRelease(window, Qt::LeftButton, Qt::NoModifier, QPoint(drawer->width() * 0.5, y), 16);
+    QCOMPARE(openedSpy.count(), 0);
+    QVERIFY(openedSpy.wait());
+    QCOMPARE(drawer->position(), qreal(1.0));
+    QCOMPARE(popupItem->x(), qreal(0.0));
+    QCOMPARE(drawer->x(), qreal(0.0));
+
+    // fling half-way closed
+    QTest::mousePress(window, Qt::LeftButton, Qt::NoModifier, QPoint(drawer->width(), y));
+    QTest::mouseMove(window, QPoint(drawer->width() * 0.75, y), 16);
+    QTest::mouseMove(window, QPoint(drawer->width() * 0.25, y), 16);
+    QCOMPARE(drawer->position(), qreal(0.5));
+    QCOMPARE(drawer->x(), popupItem->x());
+
+    // the exit transition is finalized once the drawer has settled closed
+    QTest::mouseRelease(window, Qt::LeftButton, Qt::NoModifier, QPoint(drawer->width() * 0.25, y), 16);
+    QCOMPARE(closedSpy.count(), 0);
+    QVERIFY(closedSpy.wait());
+    QCOMPARE(drawer->position(), qreal(0.0));
+    QVERIFY(!drawer->isVisible());
+}
+
 static QRectF geometry(const QQuickItem *item)
 {
     return QRectF(item->x(), item->y(), item->width(), item->height());
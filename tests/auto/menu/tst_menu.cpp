@@ -42,6 +42,7 @@
 #include <QtQml/qqmlcontext.h>
 #include <QtQuick/qquickview.h>
 #include <QtQuick/private/qquickitem_p.h>
+#include <QtQuick/private/qquickitemview_p.h>
 #include "../shared/util.h"
 #include "../shared/visualtestutil.h"
 
@@ -69,6 +70,7 @@ private slots:
     void menuSeparator();
     void repeater();
     void order();
+    void model();
 };
 
 void tst_menu::defaults()
@@ -131,6 +133,7 @@ void tst_menu::mouse()
     QCOMPARE(visibleSpy.count(), 4);
     QVERIFY(menu->isVisible());
     QVERIFY(window->overlay()->childItems().contains(menu->contentItem()->parentItem()));
+    QCOMPARE(window->overlay()->childItems().last(), menu->contentItem()->parentItem());
 
     // Try pressing within the menu and releasing outside of it; it should close.
     // TODO: won't work until QQuickPopup::releasedOutside() actually gets emitted
@@ -384,6 +387,94 @@ void tst_menu::order()
     }
 }
 
+void tst_menu::model()
+{
+    QQuickApplicationHelper helper(this, QLatin1String("model.qml"));
+    QQuickWindow *window = helper.window;
+    window->show();
+    QVERIFY(QTest::qWaitForWindowActive(window));
+
+    QQuickMenu *menu = window->property("menu").value<QQuickMenu*>();
+    QVERIFY(menu);
+    QCOMPARE(menu->currentIndex(), -1);
+
+    QSignalSpy currentIndexSpy(menu, SIGNAL(currentIndexChanged()));
+    QVERIFY(currentIndexSpy.isValid());
+
+    menu->open();
+    QVERIFY(menu->isVisible());
+
+    // only the visible part of the model is instantiated
+    QQuickItemView *view = qobject_cast<QQuickItemView *>(menu->contentItem());
+    QVERIFY(view);
+    QCOMPARE(view->count(), 1000);
+    const QList<QQuickItem *> delegates = view->contentItem()->childItems();
+    QVERIFY(!delegates.isEmpty());
+    QVERIFY(delegates.count() < 100);
+    QVERIFY(!menu->itemAt(0));
+
+    // realized items follow the width of the menu, which follows the widest item seen
+    QQuickItem *firstItem = view->currentItem() ? view->currentItem() : delegates.first();
+    QVERIFY(view->implicitWidth() > 0);
+    QCOMPARE(firstItem->width(), view->width());
+
+    // keyboard navigation operates on the model
+    QTest::keyClick(window, Qt::Key_Down);
+    QCOMPARE(menu->currentIndex(), 0);
+    QCOMPARE(currentIndexSpy.count(), 1);
+    QVERIFY(view->currentItem());
+    QVERIFY(view->currentItem()->hasActiveFocus());
+    QCOMPARE(view->currentItem()->property("idx").toInt(), 0);
+
+    QTest::keyClick(window, Qt::Key_Down);
+    QCOMPARE(menu->currentIndex(), 1);
+    QCOMPARE(currentIndexSpy.count(), 2);
+
+    // the current index does not require a live item
+    menu->setCurrentIndex(900);
+    QCOMPARE(menu->currentIndex(), 900);
+    QCOMPARE(currentIndexSpy.count(), 3);
+
+    QTest::keyClick(window, Qt::Key_Down);
+    QCOMPARE(menu->currentIndex(), 901);
+    QVERIFY(view->currentItem());
+    QCOMPARE(view->currentItem()->property("idx").toInt(), 901);
+    QVERIFY(view->currentItem()->hasActiveFocus());
+
+    // triggering a delegate closes the menu
+    QQuickMenuItem *menuItem = qobject_cast<QQuickMenuItem *>(view->currentItem());
+    QVERIFY(menuItem);
+    QSignalSpy triggeredSpy(menuItem, SIGNAL(triggered()));
+    QTest::keyClick(window, Qt::Key_Space);
+    QCOMPARE(triggeredSpy.count(), 1);
+    QTRY_VERIFY(!menu->isVisible());
+    QCOMPARE(menu->currentIndex(), -1);
+
+    // the view presents the delegate model through the content model
+    QCOMPARE(view->model().value<QObject *>(), menu->contentModel().value<QObject *>());
+
+    // switching back to the statically declared items keeps the binding of the view
+    QSignalSpy contentModelSpy(menu, SIGNAL(contentModelChanged()));
+    QVERIFY(contentModelSpy.isValid());
+    menu->setDelegate(nullptr);
+    QCOMPARE(contentModelSpy.count(), 1);
+    QCOMPARE(view->model().value<QObject *>(), menu->contentModel().value<QObject *>());
+    QCOMPARE(view->count(), 0);
+    QCOMPARE(view->implicitWidth(), 0.0);
+
+    // the header and the highlight of the view are not menu items
+    QQuickMenu *customMenu = window->property("customMenu").value<QQuickMenu*>();
+    QVERIFY(customMenu);
+    customMenu->open();
+    QVERIFY(customMenu->isVisible());
+
+    QQuickItemView *customView = qobject_cast<QQuickItemView *>(customMenu->contentItem());
+    QVERIFY(customView);
+    QVERIFY(customView->headerItem());
+    QCOMPARE(customView->implicitWidth(), 100.0);
+    QCOMPARE(customView->headerItem()->width(), 500.0);
+}
+
 QTEST_MAIN(tst_menu)
 
 #include "tst_menu.moc"
@@ -0,0 +1,136 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:BSD$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** BSD License Usage
+** Alternatively, you may use this file under the terms of the BSD license
+** as follows:
+**
+** "Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are
+** met:
+**   * Redistributions of source code must retain the above copyright
+**     notice, this list of conditions and the following disclaimer.
+**   * Redistributions in binary form must reproduce the above copyright
+**     notice, this list of conditions and the following disclaimer in
+**     the documentation and/or other materials provided with the
+**     distribution.
+**   * Neither the name of The Qt Company Ltd nor the names of its
+**     contributors may be used to endorse or promote products derived
+**     from this software without specific prior written permission.
+**
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+** "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+** LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+** A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+** OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+** SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+** LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+** DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+** THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+** (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+** OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE."
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.2
+import QtTest 1.0
+import Qt.labs.platform 1.0
+
+TestCase {
+    id: testCase
+    width: 200
+    height: 200
+    name: "FolderModel"
+
+    Component {
+        id: folderModel
+        FolderModel { }
+    }
+
+    function test_defaults() {
+        var model = folderModel.createObject(testCase)
+        verify(model)
+        compare(model.status, FolderModel.Null)
+        compare(model.count, 0)
+        compare(model.showDirs, true)
+        compare(model.showFiles, true)
+        compare(model.showHidden, false)
+        model.destroy()
+    }
+
+    function test_folder() {
+        var model = folderModel.createObject(testCase, {folder: Qt.resolvedUrl(".")})
+        verify(model)
+        tryCompare(model, "status", FolderModel.Ready)
+        verify(model.count >= 5)
+        for (var i = 0; i < model.count; ++i)
+            verify(!model.isFolder(i))
+        model.destroy()
+    }
+
+    function test_nameFilters_data() {
+        return [
+            { tag: "pattern", nameFilters: ["tst_folder*.qml"], count: 2 },
+            { tag: "suffix", nameFilters: ["*.qml"], count: -1 },
+            { tag: "filter", nameFilters: ["QML files (*.qml)"], count: -1 },
+            { tag: "none", nameFilters: ["*.nonexistent"], count: 0 }
+        ]
+    }
+
+    function test_nameFilters(data) {
+        var model = folderModel.createObject(testCase, {folder: Qt.resolvedUrl("."), nameFilters: data.nameFilters})
+        verify(model)
+        tryCompare(model, "status", FolderModel.Ready)
+        if (data.count >= 0)
+            compare(model.count, data.count)
+        else
+            verify(model.count > 0)
+        for (var i = 0; i < model.count; ++i)
+            verify(model.fileUrl(i).toString().match(/\.qml$/))
+        model.destroy()
+    }
+
+    function test_cache() {
+        var model = folderModel.createObject(testCase, {folder: Qt.resolvedUrl(".")})
+        verify(model)
+        tryCompare(model, "status", FolderModel.Ready)
+        var count = model.count
+
+        model.folder = Qt.resolvedUrl("..")
+        tryCompare(model, "status", FolderModel.Ready)
+        // folders are sorted first
+        verify(model.count > 1)
+        verify(model.isFolder(0))
+        verify(!model.isFolder(model.count - 1))
+
+        // a recently visited folder is populated from the cache right away
+        model.folder = Qt.resolvedUrl(".")
+        compare(model.status, FolderModel.Ready)
+        compare(model.count, count)
+
+        model.destroy()
+    }
+
+    function test_parentFolder() {
+        var model = folderModel.createObject(testCase, {folder: Qt.resolvedUrl(".")})
+        verify(model)
+        compare(model.parentFolder.toString() + "/", Qt.resolvedUrl("..").toString())
+        model.destroy()
+    }
+}
@@ -715,4 +715,191 @@ TestCase {
 
         control.destroy()
     }
+
+    Component {
+        id: signalSpy
+        SignalSpy { }
+    }
+
+    function test_paletteSignals() {
+        var control = button.createObject(testCase)
+        verify(control)
+
+        var rippleSpy = signalSpy.createObject(control, {target: control.Material, signalName: "rippleColorChanged"})
+        verify(rippleSpy.valid)
+        var highlightedRippleSpy = signalSpy.createObject(control, {target: control.Material, signalName: "highlightedRippleColorChanged"})
+        verify(highlightedRippleSpy.valid)
+        var buttonSpy = signalSpy.createObject(control, {target: control.Material, signalName: "buttonColorChanged"})
+        verify(buttonSpy.valid)
+        var paletteSpy = signalSpy.createObject(control, {target: control.Material, signalName: "paletteChanged"})
+        verify(paletteSpy.valid)
+
+        // the accent affects the highlighted ripple, but not the plain ripple
+        control.Material.accent = Material.Red
+        compare(highlightedRippleSpy.count, 1)
+        compare(rippleSpy.count, 0)
+        compare(paletteSpy.count, 1)
+
+        // setting the same value again must not notify
+        control.Material.accent = Material.Red
+        compare(highlightedRippleSpy.count, 1)
+        compare(paletteSpy.count, 1)
+
+        // a flat button has a different button color than a raised one
+        var buttonColor = control.Material.buttonColor
+        control.Material.elevation = 0
+        compare(buttonSpy.count, 1)
+        verify(control.Material.buttonColor !== buttonColor)
+        compare(rippleSpy.count, 0)
+        compare(paletteSpy.count, 2)
+
+        control.Material.theme = Material.Dark
+        compare(rippleSpy.count, 1)
+        compare(highlightedRippleSpy.count, 2)
+        compare(paletteSpy.count, 3)
+        compare(control.Material.rippleColor, "#20ffffff")
+
+        control.destroy()
+    }
+
+    function test_paletteSharing() {
+        var control1 = styledButton.createObject(testCase)
+        verify(control1)
+        var control2 = styledButton.createObject(testCase)
+        verify(control2)
+
+        compare(control1.Material.switchCheckedHandleColor, control2.Material.switchCheckedHandleColor)
+        compare(control1.Material.switchCheckedHandleColor, Material.color(Material.DeepPurple, Material.Shade200))
+
+        control1.Material.accent = Material.Teal
+        compare(control1.Material.switchCheckedHandleColor, Material.color(Material.Teal, Material.Shade200))
+        compare(control2.Material.switchCheckedHandleColor, Material.color(Material.DeepPurple, Material.Shade200))
+
+        control1.destroy()
+        control2.destroy()
+    }
+
+    Component {
+        id: itemDelegate
+        ItemDelegate { }
+    }
+
+    Component {
+        id: textField
+        TextField { }
+    }
+
+    function test_controlBackground() {
+        var delegate = itemDelegate.createObject(testCase)
+        verify(delegate)
+        tryCompare(delegate.background, "color", "#00000000")
+
+        delegate.highlighted = true
+        tryCompare(delegate.background, "color", delegate.Material.listHighlightColor.toString())
+
+        delegate.Material.theme = Material.Dark
+        tryCompare(delegate.background, "color", delegate.Material.listHighlightColor.toString())
+
+        delegate.highlighted = false
+        tryCompare(delegate.background, "color", "#00000000")
+
+        var field = textField.createObject(testCase)
+        verify(field)
+        tryCompare(field.background, "color", field.Material.hintTextColor.toString())
+
+        field.forceActiveFocus()
+        tryCompare(field.background, "color", field.Material.accentColor.toString())
+
+        field.Material.accent = Material.Red
+        tryCompare(field.background, "color", field.Material.accentColor.toString())
+
+        delegate.destroy()
+        field.destroy()
+    }
+
+    Component {
+        id: textArea
+        TextArea { }
+    }
+
+    Component {
+        id: spinBox
+        SpinBox { editable: true }
+    }
+
+    function findCursor(item) {
+        for (var i = 0; i < item.children.length; ++i) {
+            var child = item.children[i]
+            if (String(child).indexOf("QQuickMaterialCursor") === 0)
+                return child
+        }
+        return null
+    }
+
+    function test_cursor_data() {
+        return [
+            { tag: "TextField", component: textField },
+            { tag: "TextArea", component: textArea },
+            { tag: "SpinBox", component: spinBox }
+        ]
+    }
+
+    function test_cursor(data) {
+        var control = createTemporaryObject(data.component, testCase)
+        verify(control)
+
+        var input = control
+        if (data.tag === "SpinBox")
+            input = control.contentItem
+        else
+            input.text = "Material"
+
+        control.forceActiveFocus()
+        verify(input.activeFocus)
+
+        var cursor = findCursor(input)
+        verify(cursor)
+        compare(cursor.visible, true)
+        compare(cursor.opacity, 1)
+        // the color defaults to the accent color
+        compare(cursor.color.toString(), control.Material.accentColor.toString())
+
+        // blinks while the text control has active focus
+        tryCompare(cursor, "opacity", 0)
+
+        // moving the cursor resets the blink phase
+        input.cursorPosition = input.cursorPosition > 0 ? 0 : 1
+        compare(cursor.opacity, 1)
+        tryCompare(cursor, "opacity", 0)
+
+        // hidden while there is a selection
+        input.selectAll()
+        compare(cursor.visible, false)
+        input.deselect()
+        compare(cursor.visible, true)
+        compare(cursor.opacity, 1)
+
+        var colorSpy = signalSpy.createObject(cursor, {target: cursor, signalName: "colorChanged"})
+        verify(colorSpy.valid)
+
+        control.Material.accent = Material.Red
+        compare(colorSpy.count, 1)
+        compare(cursor.color.toString(), control.Material.accentColor.toString())
+
+        // an explicit color is not overridden by the accent color
+        cursor.color = "blue"
+        compare(colorSpy.count, 2)
+        control.Material.accent = Material.Green
+        compare(colorSpy.count, 2)
+        compare(cursor.color.toString(), "#0000ff")
+
+        cursor.color = undefined
+        compare(colorSpy.count, 3)
+        compare(cursor.color.toString(), control.Material.accentColor.toString())
+
+        // hidden without active focus
+        control.focus = false
+        verify(!input.activeFocus)
+        compare(cursor.visible, false)
+    }
 }
@@ -65,6 +65,9 @@ void tst_qquickmaterialstyleconf::conf()
     QQuickItem *label = window->property("label").value<QQuickItem*>();
     QVERIFY(label);
     QCOMPARE(label->property("color").value<QColor>(), QColor("#F44336"));
+
+    // We specified a custom font family, so the label should use it.
+    QCOMPARE(label->property("font").value<QFont>().family(), QString("Courier"));
 }
 
 QTEST_MAIN(tst_qquickmaterialstyleconf)
@@ -0,0 +1,8 @@
+CONFIG += testcase
+macos:CONFIG -= app_bundle
+TARGET = tst_qquickpaddedrectangle
+
+QT += core gui quick testlib
+QT_PRIVATE += quick-private quickcontrols2-private
+
+SOURCES += tst_qquickpaddedrectangle.cpp
@@ -0,0 +1,180 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/qtest.h>
+#include <QtTest/qsignalspy.h>
+#include <QtQuick/qquickwindow.h>
+#include <QtQuickControls2/private/qquickpaddedrectangle_p.h>
+
+class tst_qquickpaddedrectangle : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void padding();
+    void sidePadding_data();
+    void sidePadding();
+    void render();
+};
+
+void tst_qquickpaddedrectangle::padding()
+{
+    QQuickPaddedRectangle rect;
+
+    QSignalSpy paddingSpy(&rect, &QQuickPaddedRectangle::paddingChanged);
+    QSignalSpy topSpy(&rect, &QQuickPaddedRectangle::topPaddingChanged);
+    QSignalSpy leftSpy(&rect, &QQuickPaddedRectangle::leftPaddingChanged);
+    QSignalSpy rightSpy(&rect, &QQuickPaddedRectangle::rightPaddingChanged);
+    QSignalSpy bottomSpy(&rect, &QQuickPaddedRectangle::bottomPaddingChanged);
+
+    rect.setPadding(10);
+    QCOMPARE(rect.topPadding(), 10.0);
+    QCOMPARE(rect.leftPadding(), 10.0);
+    QCOMPARE(rect.rightPadding(), 10.0);
+    QCOMPARE(rect.bottomPadding(), 10.0);
+    QCOMPARE(paddingSpy.count(), 1);
+    QCOMPARE(topSpy.count(), 1);
+    QCOMPARE(leftSpy.count(), 1);
+    QCOMPARE(rightSpy.count(), 1);
+    QCOMPARE(bottomSpy.count(), 1);
+
+    // explicit sides are not affected by the padding
+    rect.setTopPadding(20);
+    rect.setBottomPadding(10);
+    QCOMPARE(topSpy.count(), 2);
+    QCOMPARE(bottomSpy.count(), 1);
+
+    rect.setPadding(5);
+    QCOMPARE(rect.topPadding(), 20.0);
+    QCOMPARE(rect.leftPadding(), 5.0);
+    QCOMPARE(rect.rightPadding(), 5.0);
+    QCOMPARE(rect.bottomPadding(), 10.0);
+    QCOMPARE(paddingSpy.count(), 2);
+    QCOMPARE(topSpy.count(), 2);
+    QCOMPARE(leftSpy.count(), 2);
+    QCOMPARE(rightSpy.count(), 2);
+    QCOMPARE(bottomSpy.count(), 1);
+
+    rect.setPadding(5);
+    QCOMPARE(paddingSpy.count(), 2);
+    QCOMPARE(leftSpy.count(), 2);
+
+    // resetting falls back to the padding
+    rect.resetTopPadding();
+    QCOMPARE(rect.topPadding(), 5.0);
+    QCOMPARE(topSpy.count(), 3);
+
+    rect.setBottomPadding(5);
+    rect.resetBottomPadding();
+    QCOMPARE(rect.bottomPadding(), 5.0);
+    QCOMPARE(bottomSpy.count(), 2);
+}
+
+void tst_qquickpaddedrectangle::sidePadding_data()
+{
+    QTest::addColumn<QByteArray>("side");
+
+    QTest::newRow("top") << QByteArray("topPadding");
+    QTest::newRow("left") << QByteArray("leftPadding");
+    QTest::newRow("right") << QByteArray("rightPadding");
+    QTest::newRow("bottom") << QByteArray("bottomPadding");
+}
+
+void tst_qquickpaddedrectangle::sidePadding()
+{
+    QFETCH(QByteArray, side);
+
+    QQuickPaddedRectangle rect;
+    rect.setPadding(10);
+
+    QList<QSignalSpy *> spies;
+    for (const char *name : {"topPadding", "leftPadding", "rightPadding", "bottomPadding"})
+        spies += new QSignalSpy(&rect, QByteArray(QByteArray("2") + name + "Changed()").constData());
+
+    // setting a side to its effective value is not a change
+    QVERIFY(rect.setProperty(side, 10));
+    for (QSignalSpy *spy : qAsConst(spies))
+        QCOMPARE(spy->count(), 0);
+
+    // only the side that changed is notified
+    QVERIFY(rect.setProperty(side, 15));
+    for (QSignalSpy *spy : qAsConst(spies))
+        QCOMPARE(spy->count(), spy->signal().contains(side) ? 1 : 0);
+    QCOMPARE(rect.property(side).toReal(), 15.0);
+
+    qDeleteAll(spies);
+}
+
+void tst_qquickpaddedrectangle::render()
+{
+    QQuickWindow window;
+    window.setColor(Qt::white);
+    window.resize(100, 100);
+
+    QQuickPaddedRectangle rect(window.contentItem());
+    rect.setSize(QSizeF(100, 100));
+    rect.setColor(Qt::red);
+    rect.setPadding(10);
+
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    QImage image = window.grabWindow();
+    QCOMPARE(image.pixelColor(image.width() / 2, image.height() / 2), QColor(Qt::red));
+    QCOMPARE(image.pixelColor(5, 5), QColor(Qt::white));
+    QCOMPARE(image.pixelColor(image.width() - 5, image.height() - 5), QColor(Qt::white));
+
+    rect.setLeftPadding(0);
+    image = window.grabWindow();
+    QCOMPARE(image.pixelColor(5, image.height() / 2), QColor(Qt::red));
+    QCOMPARE(image.pixelColor(image.width() - 5, image.height() / 2), QColor(Qt::white));
+
+    // back to no padding at all
+    rect.setPadding(0);
+    rect.resetLeftPadding();
+    image = window.grabWindow();
+    QCOMPARE(image.pixelColor(5, 5), QColor(Qt::red));
+    QCOMPARE(image.pixelColor(image.width() - 5, image.height() - 5), QColor(Qt::red));
+
+    // style changes still reach the existing node
+    rect.setColor(Qt::blue);
+    image = window.grabWindow();
+    QCOMPARE(image.pixelColor(image.width() / 2, image.height() / 2), QColor(Qt::blue));
+}
+
+QTEST_MAIN(tst_qquickpaddedrectangle)
+
+#include "tst_qquickpaddedrectangle.moc"
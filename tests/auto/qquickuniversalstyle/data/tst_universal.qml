@@ -438,4 +438,43 @@ TestCase {
 
         window.destroy()
     }
+
+    Component {
+        id: textField
+        TextField { }
+    }
+
+    function test_controlBackground() {
+        var control = button.createObject(testCase)
+        verify(control)
+        tryCompare(control.background, "color", control.Universal.baseLowColor.toString())
+        tryCompare(control.background, "borderWidth", 0)
+
+        control.down = true
+        tryCompare(control.background, "color", control.Universal.baseMediumLowColor.toString())
+        control.down = undefined
+
+        control.highlighted = true
+        tryCompare(control.background, "color", control.Universal.accent.toString())
+
+        control.flat = true
+        control.highlighted = false
+        tryCompare(control.background, "color", "#00000000")
+
+        var field = textField.createObject(testCase)
+        verify(field)
+        tryCompare(field.background, "borderWidth", 2)
+        tryCompare(field.background, "borderColor", field.Universal.chromeDisabledLowColor.toString())
+        tryCompare(field.background, "color", field.Universal.background.toString())
+
+        field.forceActiveFocus()
+        tryCompare(field.background, "borderColor", field.Universal.accent.toString())
+
+        field.enabled = false
+        tryCompare(field.background, "borderColor", field.Universal.baseLowColor.toString())
+        tryCompare(field.background, "color", field.Universal.baseLowColor.toString())
+
+        control.destroy()
+        field.destroy()
+    }
 }
@@ -0,0 +1,178 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/qtest.h>
+#include <QtQuickTemplates2/private/qquickvelocitycalculator_p_p.h>
+
+class tst_VelocityCalculator : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void constantVelocity_data();
+    void constantVelocity();
+    void pauseBeforeRelease();
+    void deceleration();
+    void pressAndRelease();
+    void sampleCount();
+    void reset();
+};
+
+// feeds a trace of (timestamp, x) pairs, sampled every 16 ms
+static QPointF feed(QQuickVelocityCalculator &calculator, const QVector<QPointF> &trace)
+{
+    for (int i = 0; i < trace.count(); ++i) {
+        const QPointF point(trace.at(i).y(), -trace.at(i).y());
+        const qint64 timestamp = qint64(trace.at(i).x());
+        if (i == 0)
+            calculator.startMeasuring(point, timestamp);
+        else if (i == trace.count() - 1)
+            calculator.stopMeasuring(point, timestamp);
+        else
+            calculator.addSample(point, timestamp);
+    }
+    return calculator.velocity();
+}
+
+void tst_VelocityCalculator::constantVelocity_data()
+{
+    QTest::addColumn<qreal>("velocity");
+    QTest::addColumn<int>("samples");
+
+    QTest::newRow("slow") << qreal(100) << 10;
+    QTest::newRow("fast") << qreal(3000) << 10;
+    QTest::newRow("backwards") << qreal(-1500) << 10;
+    QTest::newRow("long") << qreal(800) << 100;
+}
+
+void tst_VelocityCalculator::constantVelocity()
+{
+    QFETCH(qreal, velocity);
+    QFETCH(int, samples);
+
+    QVector<QPointF> trace;
+    for (int i = 0; i < samples; ++i)
+        trace += QPointF(1000 + i * 16, i * 16 * velocity / 1000);
+
+    QQuickVelocityCalculator calculator;
+    const QPointF result = feed(calculator, trace);
+    QCOMPARE(qRound(result.x()), qRound(velocity));
+    QCOMPARE(qRound(result.y()), qRound(-velocity));
+}
+
+void tst_VelocityCalculator::pauseBeforeRelease()
+{
+    // a fast swipe, followed by a pause of 300 ms before lifting the finger
+    QVector<QPointF> trace;
+    for (int i = 0; i < 10; ++i)
+        trace += QPointF(1000 + i * 16, i * 32);
+    trace += QPointF(1000 + 9 * 16 + 300, 9 * 32);
+
+    QQuickVelocityCalculator calculator;
+    QCOMPARE(feed(calculator, trace), QPointF());
+}
+
+void tst_VelocityCalculator::deceleration()
+{
+    // the finger slows down towards the end of the gesture; the estimate must
+    // be closer to the final velocity than to the average velocity of the gesture
+    QVector<QPointF> trace;
+    qreal x = 0;
+    for (int i = 0; i < 20; ++i) {
+        trace += QPointF(1000 + i * 16, x);
+        x += i < 14 ? 40 : 2;
+    }
+
+    QQuickVelocityCalculator calculator;
+    const qreal velocity = feed(calculator, trace).x();
+    const qreal average = (trace.last().y() - trace.first().y()) / ((trace.last().x() - trace.first().x()) / 1000);
+    QVERIFY(velocity > 0);
+    QVERIFY(velocity < average / 2);
+}
+
+void tst_VelocityCalculator::pressAndRelease()
+{
+    // without any move events in between, the two points alone determine the velocity
+    QQuickVelocityCalculator calculator;
+    calculator.startMeasuring(QPointF(0, 0), 1000);
+    calculator.stopMeasuring(QPointF(100, 50), 1250);
+    QCOMPARE(calculator.velocity(), QPointF(400, 200));
+
+    // identical timestamps must not result in a division by zero
+    calculator.startMeasuring(QPointF(0, 0), 1000);
+    calculator.stopMeasuring(QPointF(100, 50), 1000);
+    QCOMPARE(calculator.velocity(), QPointF());
+}
+
+void tst_VelocityCalculator::sampleCount()
+{
+    QQuickVelocityCalculator calculator;
+    QCOMPARE(calculator.sampleCount(), 0);
+
+    // samples are ignored until measuring starts
+    calculator.addSample(QPointF(1, 1), 1000);
+    QCOMPARE(calculator.sampleCount(), 0);
+
+    calculator.startMeasuring(QPointF(0, 0), 1000);
+    QCOMPARE(calculator.sampleCount(), 1);
+
+    for (int i = 1; i < 2 * QQuickVelocityCalculator::SampleCount; ++i)
+        calculator.addSample(QPointF(i, i), 1000 + i);
+    QCOMPARE(calculator.sampleCount(), int(QQuickVelocityCalculator::SampleCount));
+
+    calculator.stopMeasuring(QPointF(100, 100), 1100);
+    QCOMPARE(calculator.sampleCount(), int(QQuickVelocityCalculator::SampleCount));
+
+    // samples are ignored after measuring stopped
+    calculator.addSample(QPointF(1000, 1000), 2000);
+    QCOMPARE(calculator.sampleCount(), int(QQuickVelocityCalculator::SampleCount));
+}
+
+void tst_VelocityCalculator::reset()
+{
+    QQuickVelocityCalculator calculator;
+    calculator.startMeasuring(QPointF(0, 0), 1000);
+    calculator.stopMeasuring(QPointF(100, 0), 1100);
+    QVERIFY(calculator.velocity().x() > 0);
+
+    calculator.reset();
+    QCOMPARE(calculator.sampleCount(), 0);
+    QCOMPARE(calculator.velocity(), QPointF());
+}
+
+QTEST_MAIN(tst_VelocityCalculator)
+
+#include "tst_velocitycalculator.moc"
@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_velocitycalculator
+SOURCES += tst_velocitycalculator.cpp
+
+osx:CONFIG -= app_bundle
+
+QT += core testlib quicktemplates2-private
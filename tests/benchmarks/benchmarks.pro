@@ -1,4 +1,8 @@
 TEMPLATE = subdirs
 SUBDIRS += \
+    applicationwindow \
     creationtime \
-    objectcount
+    objectcount \
+    paddedrectangle \
+    swipedelegate \
+    textarea
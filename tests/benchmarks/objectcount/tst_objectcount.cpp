@@ -39,6 +39,10 @@
 #include <QtCore/private/qhooks_p.h>
 #include <iostream>
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
 static int qt_verbose = qgetenv("VERBOSE").toInt() != 0;
 
 Q_GLOBAL_STATIC(QObjectList, qt_qobjects)
@@ -94,10 +98,34 @@ void tst_ObjectCount::cleanup()
     qtHookData[QHooks::RemoveQObject] = 0;
 }
 
-static void printItems(const QList<QQuickItem *> &items)
+// the number of bytes currently allocated on the heap, or -1 if unknown
+static qint64 heapUsage()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return qint64(mallinfo2().uordblks);
+#elif defined(__GLIBC__)
+    return mallinfo().uordblks;
+#else
+    return -1;
+#endif
+}
+
+static void printItems(const QList<QQuickItem *> &items, qint64 bytes)
 {
+    int controls = 0;
+    for (QQuickItem *item : items) {
+        if (item->inherits("QQuickControl"))
+            ++controls;
+    }
+
     std::cout << "RESULT tst_ObjectCount::" << QTest::currentTestFunction() << "():\"" << QTest::currentDataTag() << "\":" << std::endl;
     std::cout << "     QQuickItems: " << items.count() << " (total of QObjects: " << qt_qobjects->count() << ")" << std::endl;
+    if (bytes >= 0) {
+        std::cout << "     Heap: " << bytes << " bytes";
+        if (controls > 0)
+            std::cout << " (" << bytes / controls << " bytes per control)";
+        std::cout << std::endl;
+    }
 
     if (qt_verbose) {
         for (QObject *object : qAsConst(*qt_qobjects))
@@ -145,7 +173,10 @@ static void doBenchmark(QQmlEngine *engine, const QUrl &url)
     qt_qobjects->clear();
 
     component.loadUrl(url);
+
+    const qint64 heapBefore = heapUsage();
     QScopedPointer<QObject> object(component.create());
+    const qint64 heapAfter = heapUsage();
     QVERIFY2(object.data(), qPrintable(component.errorString()));
 
     QList<QQuickItem *> items;
@@ -154,7 +185,7 @@ static void doBenchmark(QQmlEngine *engine, const QUrl &url)
         if (item)
             items += item;
     }
-    printItems(items);
+    printItems(items, heapBefore >= 0 ? heapAfter - heapBefore : -1);
 }
 
 void tst_ObjectCount::calendar()
@@ -190,7 +221,7 @@ void tst_ObjectCount::material()
 void tst_ObjectCount::material_data()
 {
     QTest::addColumn<QUrl>("url");
-    addTestRows(&engine, "controls/material", "QtQuick/Controls.2/Material", QStringList() << "Ripple" << "SliderHandle" << "CheckIndicator" << "RadioIndicator" << "SwitchIndicator" << "BoxShadow" << "ElevationEffect" << "CursorDelegate");
+    addTestRows(&engine, "controls/material", "QtQuick/Controls.2/Material", QStringList() << "Ripple" << "SliderHandle" << "CheckIndicator" << "RadioIndicator" << "SwitchIndicator" << "BoxShadow" << "ElevationEffect");
 }
 
 void tst_ObjectCount::universal()
@@ -0,0 +1,85 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest>
+#include <QtQuick>
+#include <QtQuickControls2/qquickstyle.h>
+
+class tst_PaddedRectangle : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void animatePadding();
+};
+
+static const int FrameCount = 200;
+
+void tst_PaddedRectangle::initTestCase()
+{
+    QQuickStyle::setStyle("Material");
+}
+
+void tst_PaddedRectangle::animatePadding()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, QUrl::fromLocalFile(QFINDTESTDATA("data/padding.qml")));
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(!object.isNull(), qPrintable(component.errorString()));
+
+    QQuickWindow *window = qobject_cast<QQuickWindow *>(object.data());
+    QVERIFY(window);
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window));
+
+    QSignalSpy frameSpy(window, SIGNAL(frameSwapped()));
+    QVERIFY(frameSpy.isValid());
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < FrameCount; ++i) {
+        window->setProperty("inset", i % 5);
+        QVERIFY(frameSpy.wait());
+    }
+    const qint64 elapsed = timer.nsecsElapsed();
+
+    QTest::setBenchmarkResult(elapsed / 1000000.0 / FrameCount, QTest::WalltimeMilliseconds);
+}
+
+QTEST_MAIN(tst_PaddedRectangle)
+
+#include "tst_paddedrectangle.moc"
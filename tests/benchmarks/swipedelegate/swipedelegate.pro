@@ -0,0 +1,12 @@
+TEMPLATE = app
+TARGET = tst_swipedelegate
+
+QT += quick testlib
+CONFIG += testcase
+osx:CONFIG -= app_bundle
+
+SOURCES += \
+    tst_swipedelegate.cpp
+
+TESTDATA += \
+    $$PWD/data/*.qml
@@ -0,0 +1,99 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest>
+#include <QtQuick>
+
+class tst_SwipeDelegate : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void swipeRows();
+};
+
+static const int PageCount = 20;
+static const int MoveSteps = 10;
+
+// swipes the row at the given y position to the left, releases, and closes it again
+static void swipeRow(QQuickWindow *window, QQuickItem *row, int y)
+{
+    const int from = window->width() - 10;
+    const int to = window->width() / 3;
+
+    QTest::mousePress(window, Qt::LeftButton, Qt::NoModifier, QPoint(from, y));
+    // the frames between the press and the drag, which finish incubating the swipe items
+    QCoreApplication::processEvents();
+    for (int i = 1; i <= MoveSteps; ++i)
+        QTest::mouseMove(window, QPoint(from - (from - to) * i / MoveSteps, y));
+    QTest::mouseRelease(window, Qt::LeftButton, Qt::NoModifier, QPoint(to, y));
+
+    QObject *swipe = row->property("swipe").value<QObject *>();
+    QMetaObject::invokeMethod(swipe, "close");
+}
+
+void tst_SwipeDelegate::swipeRows()
+{
+    QQuickView view(QUrl::fromLocalFile(QFINDTESTDATA("data/swipelist.qml")));
+    QCOMPARE(view.status(), QQuickView::Ready);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QQuickItem *listView = view.rootObject();
+    QVERIFY(listView);
+    QQuickItem *contentItem = listView->property("contentItem").value<QQuickItem *>();
+    QVERIFY(contentItem);
+
+    // every page of rows is swiped once, so that each row creates its swipe items
+    QBENCHMARK_ONCE {
+        for (int page = 0; page < PageCount; ++page) {
+            listView->setProperty("contentY", page * listView->height());
+            QCoreApplication::processEvents();
+
+            const QList<QQuickItem *> items = contentItem->childItems();
+            for (QQuickItem *item : items) {
+                const int y = listView->mapFromItem(item, QPointF(0, item->height() / 2)).y();
+                if (!item->isVisible() || y < 0 || y > listView->height())
+                    continue;
+                swipeRow(&view, item, y);
+            }
+        }
+    }
+}
+
+QTEST_MAIN(tst_SwipeDelegate)
+
+#include "tst_swipedelegate.moc"
@@ -0,0 +1,12 @@
+TEMPLATE = app
+TARGET = tst_textarea
+
+QT += quick quickcontrols2 testlib
+CONFIG += testcase
+osx:CONFIG -= app_bundle
+
+SOURCES += \
+    tst_textarea.cpp
+
+TESTDATA += \
+    $$PWD/data/*.qml
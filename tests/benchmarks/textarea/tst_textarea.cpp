@@ -0,0 +1,112 @@
+/****************************************************************************
+**
+** Copyright (C) 2017 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest>
+#include <QtQuick>
+#include <QtQuickControls2/qquickstyle.h>
+
+class tst_TextArea : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void append_data();
+    void append();
+};
+
+static const int AppendCount = 10000;
+static const int LinesPerFrame = 100;
+
+void tst_TextArea::initTestCase()
+{
+    QQuickStyle::setStyle("Default");
+}
+
+void tst_TextArea::append_data()
+{
+    QTest::addColumn<bool>("followTail");
+
+    QTest::newRow("cursor") << false;
+    QTest::newRow("followTail") << true;
+}
+
+void tst_TextArea::append()
+{
+    QFETCH(bool, followTail);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, QUrl::fromLocalFile(QFINDTESTDATA("data/log.qml")));
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY2(!object.isNull(), qPrintable(component.errorString()));
+
+    QQuickWindow *window = qobject_cast<QQuickWindow *>(object.data());
+    QVERIFY(window);
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window));
+
+    QQuickItem *textArea = window->property("textArea").value<QQuickItem *>();
+    QVERIFY(textArea);
+    textArea->setProperty("followTail", followTail);
+
+    QQuickItem *flickable = textArea->parentItem()->parentItem();
+    QVERIFY(flickable);
+
+    // every flickable synchronization that does any work resizes the content
+    QSignalSpy syncSpy(flickable, SIGNAL(contentHeightChanged()));
+    QVERIFY(syncSpy.isValid());
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < AppendCount; ++i) {
+        QMetaObject::invokeMethod(textArea, "append", Q_ARG(QString, QStringLiteral("line %1").arg(i)));
+        if (i % LinesPerFrame == LinesPerFrame - 1)
+            QCoreApplication::processEvents();
+    }
+    const qreal padding = textArea->property("topPadding").toReal() + textArea->property("bottomPadding").toReal();
+    QTRY_COMPARE(flickable->property("contentHeight").toReal(), textArea->property("contentHeight").toReal() + padding);
+    const qint64 elapsed = timer.nsecsElapsed();
+
+    qInfo("%d appends, %d flickable content height changes", AppendCount, syncSpy.count());
+    QVERIFY(syncSpy.count() <= AppendCount / LinesPerFrame + 1);
+    if (followTail)
+        QCOMPARE(flickable->property("contentY").toReal(), flickable->property("contentHeight").toReal() - flickable->height());
+    QTest::setBenchmarkResult(elapsed / 1000000.0, QTest::WalltimeMilliseconds);
+}
+
+QTEST_MAIN(tst_TextArea)
+
+#include "tst_textarea.moc"